@@ -3,6 +3,7 @@
 #include <Utf8.h>
 
 #include <algorithm>
+#include <cstdlib>
 
 void EpdFont::getTextBounds(const char* string, const int startX, const int startY, int* minX, int* minY, int* maxX,
                             int* maxY) const {
@@ -48,6 +49,88 @@ void EpdFont::getTextDimensions(const char* string, int* w, int* h) const {
   *h = maxY - minY;
 }
 
+int EpdFont::getTextWidth(const char* string) const {
+  int minX = 0;
+  int maxX = 0;
+  int cursorX = 0;
+  uint32_t cp;
+  while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&string)))) {
+    const EpdGlyph* glyph = getGlyph(cp);
+
+    if (!glyph) {
+      glyph = getGlyph('?');
+    }
+
+    if (!glyph) {
+      continue;
+    }
+
+    minX = std::min(minX, cursorX + glyph->left);
+    maxX = std::max(maxX, cursorX + glyph->left + glyph->width);
+    cursorX += glyph->advanceX;
+  }
+
+  return maxX - minX;
+}
+
+size_t EpdFont::fitText(const char* string, const int maxWidth, const char* ellipsis, int* fitWidth) const {
+  // Horizontal bounds of the ellipsis relative to where it starts
+  int ellipsisMinX = 0;
+  int ellipsisMaxX = 0;
+  int ellipsisMinY = 0;
+  int ellipsisMaxY = 0;
+  getTextBounds(ellipsis, 0, 0, &ellipsisMinX, &ellipsisMinY, &ellipsisMaxX, &ellipsisMaxY);
+
+  const char* start = string;
+  int minX = 0;
+  int maxX = 0;
+  int cursorX = 0;
+  size_t cut = 0;
+  int cutWidth = ellipsisMaxX - ellipsisMinX;
+  uint32_t cp;
+  while (true) {
+    // Would the text so far plus the ellipsis still fit? Trailing spaces are left out of the cut
+    if (string == start || string[-1] != ' ') {
+      const int width = std::max(maxX, cursorX + ellipsisMaxX) - std::min(minX, cursorX + ellipsisMinX);
+      if (width <= maxWidth) {
+        cut = string - start;
+        cutWidth = width;
+      }
+    }
+
+    const char* next = string;
+    if (!(cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&next)))) {
+      break;
+    }
+    string = next;
+
+    const EpdGlyph* glyph = getGlyph(cp);
+    if (!glyph) {
+      glyph = getGlyph('?');
+    }
+    if (!glyph) {
+      continue;
+    }
+
+    minX = std::min(minX, cursorX + glyph->left);
+    maxX = std::max(maxX, cursorX + glyph->left + glyph->width);
+    cursorX += glyph->advanceX;
+    if (maxX - minX > maxWidth) {
+      // Nothing from here on fits, the cut found so far stands
+      if (fitWidth) {
+        *fitWidth = cutWidth;
+      }
+      return cut;
+    }
+  }
+
+  // Reached the end without running out of room, the whole string fits
+  if (fitWidth) {
+    *fitWidth = maxX - minX;
+  }
+  return string - start;
+}
+
 bool EpdFont::hasPrintableChars(const char* string) const {
   int w = 0, h = 0;
 
@@ -56,7 +139,59 @@ bool EpdFont::hasPrintableChars(const char* string) const {
   return w > 0 || h > 0;
 }
 
+EpdFont::~EpdFont() { free(fastBlocks); }
+
+void EpdFont::buildFastBlocks() const {
+  fastBlocksBuilt = true;
+  fastBlocks = static_cast<FastBlock*>(calloc(FAST_BLOCK_COUNT, sizeof(FastBlock)));
+  if (!fastBlocks) {
+    return;
+  }
+
+  for (int block = 0; block < FAST_BLOCK_COUNT; block++) {
+    const uint32_t first =
+        block < FAST_LATIN_BLOCKS ? block * 16 : FAST_PUNCTUATION_START + (block - FAST_LATIN_BLOCKS) * 16;
+    FastBlock& fastBlock = fastBlocks[block];
+    for (uint32_t i = 0; i < 16; i++) {
+      const EpdGlyph* glyph = searchGlyph(first + i);
+      if (!glyph) {
+        continue;
+      }
+      if (fastBlock.present == 0) {
+        fastBlock.firstGlyph = glyph - data->glyph;
+      }
+      fastBlock.present |= 1 << i;
+    }
+  }
+}
+
 const EpdGlyph* EpdFont::getGlyph(const uint32_t cp) const {
+  int block;
+  if (cp < FAST_LATIN_END) {
+    block = cp / 16;
+  } else if (cp >= FAST_PUNCTUATION_START && cp < FAST_PUNCTUATION_END) {
+    block = FAST_LATIN_BLOCKS + (cp - FAST_PUNCTUATION_START) / 16;
+  } else {
+    return searchGlyph(cp);
+  }
+
+  if (!fastBlocksBuilt) {
+    buildFastBlocks();
+  }
+  if (!fastBlocks) {
+    return searchGlyph(cp);
+  }
+
+  const FastBlock& fastBlock = fastBlocks[block];
+  const uint16_t bit = 1 << (cp % 16);
+  if (!(fastBlock.present & bit)) {
+    return nullptr;
+  }
+  // Glyphs are stored in code point order, so the ones present below cp in this block come right before it
+  return &data->glyph[fastBlock.firstGlyph + __builtin_popcount(fastBlock.present & (bit - 1))];
+}
+
+const EpdGlyph* EpdFont::searchGlyph(const uint32_t cp) const {
   const EpdUnicodeInterval* intervals = data->intervals;
   const int count = data->intervalCount;
 
@@ -1,14 +1,42 @@
 #pragma once
+#include <cstddef>
+
 #include "EpdFontData.h"
 
 class EpdFont {
+  // Direct index over the code points nearly all book text is made of (Latin, Latin-1, Latin Extended-A and general
+  // punctuation), so those never go through the interval search. Each block of 16 code points keeps the glyph index
+  // of its first present code point and a bit per present code point, the glyph index is that plus the set bits below
+  struct FastBlock {
+    uint16_t firstGlyph;
+    uint16_t present;
+  };
+  static constexpr uint32_t FAST_LATIN_END = 0x180;
+  static constexpr uint32_t FAST_PUNCTUATION_START = 0x2000;
+  static constexpr uint32_t FAST_PUNCTUATION_END = 0x2070;
+  static constexpr int FAST_LATIN_BLOCKS = FAST_LATIN_END / 16;
+  static constexpr int FAST_BLOCK_COUNT = FAST_LATIN_BLOCKS + (FAST_PUNCTUATION_END - FAST_PUNCTUATION_START) / 16;
+  // Built on first lookup, so only the fonts that actually get used spend heap on it. Stays nullptr if it could not
+  // be allocated, lookups then go through the interval search
+  mutable FastBlock* fastBlocks = nullptr;
+  mutable bool fastBlocksBuilt = false;
+
+  void buildFastBlocks() const;
+  const EpdGlyph* searchGlyph(uint32_t cp) const;
   void getTextBounds(const char* string, int startX, int startY, int* minX, int* minY, int* maxX, int* maxY) const;
 
  public:
   const EpdFontData* data;
   explicit EpdFont(const EpdFontData* data) : data(data) {}
-  ~EpdFont() = default;
+  EpdFont(const EpdFont&) = delete;
+  EpdFont& operator=(const EpdFont&) = delete;
+  ~EpdFont();
   void getTextDimensions(const char* string, int* w, int* h) const;
+  // Same width as getTextDimensions, without the vertical bounds
+  int getTextWidth(const char* string) const;
+  // Walks the string once and returns how many bytes of it fit within maxWidth. If the whole string does not fit the
+  // cut leaves room for the ellipsis after it. The width of what fits, ellipsis included, is written to fitWidth
+  size_t fitText(const char* string, int maxWidth, const char* ellipsis, int* fitWidth) const;
   bool hasPrintableChars(const char* string) const;
 
   const EpdGlyph* getGlyph(uint32_t cp) const;
@@ -26,6 +26,15 @@ void EpdFontFamily::getTextDimensions(const char* string, int* w, int* h, const
   getFont(style)->getTextDimensions(string, w, h);
 }
 
+int EpdFontFamily::getTextWidth(const char* string, const Style style) const {
+  return getFont(style)->getTextWidth(string);
+}
+
+size_t EpdFontFamily::fitText(const char* string, const int maxWidth, const char* ellipsis, int* fitWidth,
+                              const Style style) const {
+  return getFont(style)->fitText(string, maxWidth, ellipsis, fitWidth);
+}
+
 bool EpdFontFamily::hasPrintableChars(const char* string, const Style style) const {
   return getFont(style)->hasPrintableChars(string);
 }
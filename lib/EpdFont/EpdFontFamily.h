@@ -10,6 +10,8 @@ class EpdFontFamily {
       : regular(regular), bold(bold), italic(italic), boldItalic(boldItalic) {}
   ~EpdFontFamily() = default;
   void getTextDimensions(const char* string, int* w, int* h, Style style = REGULAR) const;
+  int getTextWidth(const char* string, Style style = REGULAR) const;
+  size_t fitText(const char* string, int maxWidth, const char* ellipsis, int* fitWidth, Style style = REGULAR) const;
   bool hasPrintableChars(const char* string, Style style = REGULAR) const;
   const EpdFontData* getData(Style style = REGULAR) const;
   const EpdGlyph* getGlyph(uint32_t cp, Style style = REGULAR) const;
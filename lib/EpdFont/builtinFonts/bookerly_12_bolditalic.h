@@ -3294,11 +3294,11 @@ static const uint8_t bookerly_12_bolditalicBitmaps[52522] = {
 };
 
 static const EpdGlyph bookerly_12_bolditalicGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 5, 0, 0, 0, 0 }, // 	
-    { 0, 0, 5, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 5, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 5, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 5, 0, 0, 0, 0 }, //  
     { 8, 20, 8, 1, 19, 40, 0 }, // !
     { 10, 9, 10, 1, 18, 23, 40 }, // "
@@ -3407,7 +3407,7 @@ static const EpdGlyph bookerly_12_bolditalicGlyphs[] = {
     { 10, 13, 11, 1, 18, 33, 6838 }, // ª
     { 15, 11, 15, 0, 12, 42, 6871 }, // «
     { 12, 7, 16, 2, 12, 21, 6913 }, // ¬
-    { 8, 3, 10, 1, 8, 6, 6934 }, // ­
+    { 8, 3, 10, 1, 8, 6, 6934 }, // U+00AD
     { 14, 14, 15, 0, 20, 49, 6940 }, // ®
     { 9, 3, 16, 3, 18, 7, 6989 }, // ¯
     { 10, 10, 13, 2, 18, 25, 6996 }, // °
@@ -3882,11 +3882,11 @@ static const EpdGlyph bookerly_12_bolditalicGlyphs[] = {
     { 0, 0, 8, 0, 0, 0, 45609 }, //  
     { 0, 0, 5, 0, 0, 0, 45609 }, //  
     { 0, 0, 1, 0, 0, 0, 45609 }, //  
-    { 0, 0, 0, 0, 0, 0, 45609 }, // ​
-    { 2, 21, 0, -1, 15, 11, 45609 }, // ‌
-    { 6, 23, 0, -3, 17, 35, 45620 }, // ‍
-    { 8, 24, 0, -4, 18, 48, 45655 }, // ‎
-    { 8, 24, 0, -4, 18, 48, 45703 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 45609 }, // U+200B
+    { 2, 21, 0, -1, 15, 11, 45609 }, // U+200C
+    { 6, 23, 0, -3, 17, 35, 45620 }, // U+200D
+    { 8, 24, 0, -4, 18, 48, 45655 }, // U+200E
+    { 8, 24, 0, -4, 18, 48, 45703 }, // U+200F
     { 8, 3, 10, 1, 8, 6, 45751 }, // ‐
     { 8, 3, 10, 1, 8, 6, 45757 }, // ‑
     { 13, 3, 16, 1, 10, 10, 45763 }, // ‒
@@ -3913,11 +3913,11 @@ static const EpdGlyph bookerly_12_bolditalicGlyphs[] = {
     { 5, 5, 7, 1, 9, 7, 46255 }, // ‧
     { 0, 0, 0, 0, 0, 0, 46262 }, //  
     { 0, 0, 0, 0, 0, 0, 46262 }, //  
-    { 8, 24, 0, -4, 18, 48, 46262 }, // ‪
-    { 8, 24, 0, -4, 18, 48, 46310 }, // ‫
-    { 8, 24, 0, -4, 18, 48, 46358 }, // ‬
-    { 11, 24, 0, -5, 18, 66, 46406 }, // ‭
-    { 11, 24, 0, -5, 18, 66, 46472 }, // ‮
+    { 8, 24, 0, -4, 18, 48, 46262 }, // U+202A
+    { 8, 24, 0, -4, 18, 48, 46310 }, // U+202B
+    { 8, 24, 0, -4, 18, 48, 46358 }, // U+202C
+    { 11, 24, 0, -5, 18, 66, 46406 }, // U+202D
+    { 11, 24, 0, -5, 18, 66, 46472 }, // U+202E
     { 0, 0, 3, 0, 0, 0, 46538 }, //  
     { 33, 21, 35, 1, 19, 174, 46538 }, // ‰
     { 6, 9, 6, 0, 18, 14, 46712 }, // ′
@@ -3940,11 +3940,11 @@ static const EpdGlyph bookerly_12_bolditalicGlyphs[] = {
     { 15, 6, 25, 5, 10, 23, 47441 }, // ⁓
     { 23, 9, 23, 0, 18, 52, 47464 }, // ⁗
     { 0, 0, 6, 0, 0, 0, 47516 }, //  
-    { 0, 0, 0, 0, 0, 0, 47516 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 47516 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 47516 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 47516 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 47516 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 47516 }, // U+2060
+    { 0, 0, 0, 0, 0, 0, 47516 }, // U+2061
+    { 0, 0, 0, 0, 0, 0, 47516 }, // U+2062
+    { 0, 0, 0, 0, 0, 0, 47516 }, // U+2063
+    { 0, 0, 0, 0, 0, 0, 47516 }, // U+2064
     { 17, 18, 16, -1, 18, 77, 47516 }, // ₣
     { 17, 19, 16, -1, 18, 81, 47593 }, // ₤
     { 33, 19, 33, 0, 18, 157, 47674 }, // ₧
@@ -2953,11 +2953,11 @@ static const uint8_t bookerly_12_regularBitmaps[47071] = {
 };
 
 static const EpdGlyph bookerly_12_regularGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 5, 0, 0, 0, 0 }, // 	
-    { 0, 0, 5, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 5, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 5, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 5, 0, 0, 0, 0 }, //  
     { 4, 20, 7, 2, 19, 20, 0 }, // !
     { 7, 8, 9, 1, 18, 14, 20 }, // "
@@ -3066,7 +3066,7 @@ static const EpdGlyph bookerly_12_regularGlyphs[] = {
     { 9, 12, 11, 1, 18, 27, 5915 }, // ª
     { 14, 10, 13, 0, 11, 35, 5942 }, // «
     { 11, 7, 16, 2, 12, 20, 5977 }, // ¬
-    { 8, 3, 9, 1, 8, 6, 5997 }, // ­
+    { 8, 3, 9, 1, 8, 6, 5997 }, // U+00AD
     { 14, 14, 15, 0, 20, 49, 6003 }, // ®
     { 9, 3, 17, 4, 18, 7, 6052 }, // ¯
     { 9, 9, 13, 2, 18, 21, 6059 }, // °
@@ -3541,11 +3541,11 @@ static const EpdGlyph bookerly_12_regularGlyphs[] = {
     { 0, 0, 7, 0, 0, 0, 40724 }, //  
     { 0, 0, 5, 0, 0, 0, 40724 }, //  
     { 0, 0, 1, 0, 0, 0, 40724 }, //  
-    { 0, 0, 0, 0, 0, 0, 40724 }, // ​
-    { 2, 21, 0, -1, 15, 11, 40724 }, // ‌
-    { 6, 23, 0, -3, 17, 35, 40735 }, // ‍
-    { 8, 24, 0, -4, 18, 48, 40770 }, // ‎
-    { 8, 24, 0, -4, 18, 48, 40818 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 40724 }, // U+200B
+    { 2, 21, 0, -1, 15, 11, 40724 }, // U+200C
+    { 6, 23, 0, -3, 17, 35, 40735 }, // U+200D
+    { 8, 24, 0, -4, 18, 48, 40770 }, // U+200E
+    { 8, 24, 0, -4, 18, 48, 40818 }, // U+200F
     { 8, 3, 9, 1, 8, 6, 40866 }, // ‐
     { 8, 3, 9, 1, 8, 6, 40872 }, // ‑
     { 12, 3, 16, 2, 10, 9, 40878 }, // ‒
@@ -3572,11 +3572,11 @@ static const EpdGlyph bookerly_12_regularGlyphs[] = {
     { 5, 4, 7, 1, 9, 5, 41319 }, // ‧
     { 0, 0, 0, 0, 0, 0, 41324 }, //  
     { 0, 0, 0, 0, 0, 0, 41324 }, //  
-    { 8, 24, 0, -4, 18, 48, 41324 }, // ‪
-    { 8, 24, 0, -4, 18, 48, 41372 }, // ‫
-    { 8, 24, 0, -4, 18, 48, 41420 }, // ‬
-    { 11, 24, 0, -5, 18, 66, 41468 }, // ‭
-    { 11, 24, 0, -5, 18, 66, 41534 }, // ‮
+    { 8, 24, 0, -4, 18, 48, 41324 }, // U+202A
+    { 8, 24, 0, -4, 18, 48, 41372 }, // U+202B
+    { 8, 24, 0, -4, 18, 48, 41420 }, // U+202C
+    { 11, 24, 0, -5, 18, 66, 41468 }, // U+202D
+    { 11, 24, 0, -5, 18, 66, 41534 }, // U+202E
     { 0, 0, 3, 0, 0, 0, 41600 }, //  
     { 32, 21, 34, 1, 19, 168, 41600 }, // ‰
     { 5, 9, 7, 1, 18, 12, 41768 }, // ′
@@ -3599,11 +3599,11 @@ static const EpdGlyph bookerly_12_regularGlyphs[] = {
     { 15, 5, 25, 5, 10, 19, 42444 }, // ⁓
     { 20, 9, 21, 1, 18, 45, 42463 }, // ⁗
     { 0, 0, 6, 0, 0, 0, 42508 }, //  
-    { 0, 0, 0, 0, 0, 0, 42508 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 42508 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 42508 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 42508 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 42508 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 42508 }, // U+2060
+    { 0, 0, 0, 0, 0, 0, 42508 }, // U+2061
+    { 0, 0, 0, 0, 0, 0, 42508 }, // U+2062
+    { 0, 0, 0, 0, 0, 0, 42508 }, // U+2063
+    { 0, 0, 0, 0, 0, 0, 42508 }, // U+2064
     { 13, 18, 16, 1, 18, 59, 42508 }, // ₣
     { 14, 19, 16, 1, 18, 67, 42567 }, // ₤
     { 31, 19, 31, 0, 18, 148, 42634 }, // ₧
@@ -4200,11 +4200,11 @@ static const uint8_t bookerly_14_boldBitmaps[67020] = {
 };
 
 static const EpdGlyph bookerly_14_boldGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 6, 0, 0, 0, 0 }, // 	
-    { 0, 0, 6, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 6, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 6, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 6, 0, 0, 0, 0 }, //  
     { 6, 23, 8, 2, 22, 35, 0 }, // !
     { 10, 10, 12, 1, 21, 25, 35 }, // "
@@ -4313,7 +4313,7 @@ static const EpdGlyph bookerly_14_boldGlyphs[] = {
     { 11, 15, 13, 1, 21, 42, 8422 }, // ª
     { 16, 12, 17, 0, 13, 48, 8464 }, // «
     { 14, 8, 18, 2, 14, 28, 8512 }, // ¬
-    { 9, 5, 11, 1, 10, 12, 8540 }, // ­
+    { 9, 5, 11, 1, 10, 12, 8540 }, // U+00AD
     { 17, 16, 17, 0, 23, 68, 8552 }, // ®
     { 11, 3, 20, 4, 21, 9, 8620 }, // ¯
     { 11, 12, 15, 2, 21, 33, 8629 }, // °
@@ -4788,11 +4788,11 @@ static const EpdGlyph bookerly_14_boldGlyphs[] = {
     { 0, 0, 8, 0, 0, 0, 57914 }, //  
     { 0, 0, 6, 0, 0, 0, 57914 }, //  
     { 0, 0, 1, 0, 0, 0, 57914 }, //  
-    { 0, 0, 0, 0, 0, 0, 57914 }, // ​
-    { 2, 24, 0, -1, 17, 12, 57914 }, // ‌
-    { 6, 26, 0, -3, 19, 39, 57926 }, // ‍
-    { 10, 28, 0, -5, 21, 70, 57965 }, // ‎
-    { 10, 28, 0, -5, 21, 70, 58035 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 57914 }, // U+200B
+    { 2, 24, 0, -1, 17, 12, 57914 }, // U+200C
+    { 6, 26, 0, -3, 19, 39, 57926 }, // U+200D
+    { 10, 28, 0, -5, 21, 70, 57965 }, // U+200E
+    { 10, 28, 0, -5, 21, 70, 58035 }, // U+200F
     { 9, 5, 11, 1, 10, 12, 58105 }, // ‐
     { 9, 5, 11, 1, 10, 12, 58117 }, // ‑
     { 14, 3, 18, 2, 11, 11, 58129 }, // ‒
@@ -4819,11 +4819,11 @@ static const EpdGlyph bookerly_14_boldGlyphs[] = {
     { 6, 6, 8, 1, 11, 9, 58748 }, // ‧
     { 0, 0, 0, 0, 0, 0, 58757 }, //  
     { 0, 0, 0, 0, 0, 0, 58757 }, //  
-    { 10, 28, 0, -5, 21, 70, 58757 }, // ‪
-    { 10, 28, 0, -5, 21, 70, 58827 }, // ‫
-    { 10, 27, 0, -5, 20, 68, 58897 }, // ‬
-    { 12, 28, 0, -6, 21, 84, 58965 }, // ‭
-    { 12, 28, 0, -6, 21, 84, 59049 }, // ‮
+    { 10, 28, 0, -5, 21, 70, 58757 }, // U+202A
+    { 10, 28, 0, -5, 21, 70, 58827 }, // U+202B
+    { 10, 27, 0, -5, 20, 68, 58897 }, // U+202C
+    { 12, 28, 0, -6, 21, 84, 58965 }, // U+202D
+    { 12, 28, 0, -6, 21, 84, 59049 }, // U+202E
     { 0, 0, 3, 0, 0, 0, 59133 }, //  
     { 39, 24, 40, 1, 22, 234, 59133 }, // ‰
     { 8, 11, 8, 0, 21, 22, 59367 }, // ′
@@ -4846,11 +4846,11 @@ static const EpdGlyph bookerly_14_boldGlyphs[] = {
     { 17, 7, 29, 6, 12, 30, 60329 }, // ⁓
     { 27, 11, 27, 0, 21, 75, 60359 }, // ⁗
     { 0, 0, 6, 0, 0, 0, 60434 }, //  
-    { 0, 0, 0, 0, 0, 0, 60434 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 60434 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 60434 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 60434 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 60434 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 60434 }, // U+2060
+    { 0, 0, 0, 0, 0, 0, 60434 }, // U+2061
+    { 0, 0, 0, 0, 0, 0, 60434 }, // U+2062
+    { 0, 0, 0, 0, 0, 0, 60434 }, // U+2063
+    { 0, 0, 0, 0, 0, 0, 60434 }, // U+2064
     { 16, 20, 18, 1, 20, 80, 60434 }, // ₣
     { 18, 22, 18, 0, 21, 99, 60514 }, // ₤
     { 39, 22, 39, 0, 21, 215, 60613 }, // ₧
@@ -3929,11 +3929,11 @@ static const uint8_t bookerly_14_regularBitmaps[62675] = {
 };
 
 static const EpdGlyph bookerly_14_regularGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 6, 0, 0, 0, 0 }, // 	
-    { 0, 0, 6, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 6, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 6, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 6, 0, 0, 0, 0 }, //  
     { 5, 23, 8, 2, 22, 29, 0 }, // !
     { 9, 9, 11, 1, 21, 21, 29 }, // "
@@ -4042,7 +4042,7 @@ static const EpdGlyph bookerly_14_regularGlyphs[] = {
     { 11, 14, 13, 1, 21, 39, 7876 }, // ª
     { 15, 11, 15, 1, 13, 42, 7915 }, // «
     { 13, 8, 18, 3, 14, 26, 7957 }, // ¬
-    { 9, 3, 11, 1, 9, 7, 7983 }, // ­
+    { 9, 3, 11, 1, 9, 7, 7983 }, // U+00AD
     { 17, 16, 17, 0, 23, 68, 7990 }, // ®
     { 10, 3, 19, 5, 21, 8, 8058 }, // ¯
     { 11, 11, 15, 2, 21, 31, 8066 }, // °
@@ -4517,11 +4517,11 @@ static const EpdGlyph bookerly_14_regularGlyphs[] = {
     { 0, 0, 8, 0, 0, 0, 54302 }, //  
     { 0, 0, 6, 0, 0, 0, 54302 }, //  
     { 0, 0, 1, 0, 0, 0, 54302 }, //  
-    { 0, 0, 0, 0, 0, 0, 54302 }, // ​
-    { 2, 24, 0, -1, 17, 12, 54302 }, // ‌
-    { 6, 26, 0, -3, 19, 39, 54314 }, // ‍
-    { 10, 28, 0, -5, 21, 70, 54353 }, // ‎
-    { 10, 28, 0, -5, 21, 70, 54423 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 54302 }, // U+200B
+    { 2, 24, 0, -1, 17, 12, 54302 }, // U+200C
+    { 6, 26, 0, -3, 19, 39, 54314 }, // U+200D
+    { 10, 28, 0, -5, 21, 70, 54353 }, // U+200E
+    { 10, 28, 0, -5, 21, 70, 54423 }, // U+200F
     { 9, 3, 11, 1, 9, 7, 54493 }, // ‐
     { 9, 3, 11, 1, 9, 7, 54500 }, // ‑
     { 14, 3, 18, 2, 11, 11, 54507 }, // ‒
@@ -4548,11 +4548,11 @@ static const EpdGlyph bookerly_14_regularGlyphs[] = {
     { 6, 4, 8, 1, 10, 6, 55089 }, // ‧
     { 0, 0, 0, 0, 0, 0, 55095 }, //  
     { 0, 0, 0, 0, 0, 0, 55095 }, //  
-    { 10, 28, 0, -5, 21, 70, 55095 }, // ‪
-    { 10, 28, 0, -5, 21, 70, 55165 }, // ‫
-    { 10, 27, 0, -5, 20, 68, 55235 }, // ‬
-    { 12, 28, 0, -6, 21, 84, 55303 }, // ‭
-    { 12, 28, 0, -6, 21, 84, 55387 }, // ‮
+    { 10, 28, 0, -5, 21, 70, 55095 }, // U+202A
+    { 10, 28, 0, -5, 21, 70, 55165 }, // U+202B
+    { 10, 27, 0, -5, 20, 68, 55235 }, // U+202C
+    { 12, 28, 0, -6, 21, 84, 55303 }, // U+202D
+    { 12, 28, 0, -6, 21, 84, 55387 }, // U+202E
     { 0, 0, 3, 0, 0, 0, 55471 }, //  
     { 38, 24, 40, 1, 22, 228, 55471 }, // ‰
     { 6, 10, 8, 1, 21, 15, 55699 }, // ′
@@ -4575,11 +4575,11 @@ static const EpdGlyph bookerly_14_regularGlyphs[] = {
     { 17, 5, 29, 6, 11, 22, 56568 }, // ⁓
     { 23, 10, 25, 1, 21, 58, 56590 }, // ⁗
     { 0, 0, 6, 0, 0, 0, 56648 }, //  
-    { 0, 0, 0, 0, 0, 0, 56648 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 56648 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 56648 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 56648 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 56648 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 56648 }, // U+2060
+    { 0, 0, 0, 0, 0, 0, 56648 }, // U+2061
+    { 0, 0, 0, 0, 0, 0, 56648 }, // U+2062
+    { 0, 0, 0, 0, 0, 0, 56648 }, // U+2063
+    { 0, 0, 0, 0, 0, 0, 56648 }, // U+2064
     { 15, 20, 18, 1, 20, 75, 56648 }, // ₣
     { 16, 22, 18, 1, 21, 88, 56723 }, // ₤
     { 36, 22, 36, 0, 21, 198, 56811 }, // ₧
@@ -5334,11 +5334,11 @@ static const uint8_t bookerly_16_boldBitmaps[85154] = {
 };
 
 static const EpdGlyph bookerly_16_boldGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 7, 0, 0, 0, 0 }, // 	
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 7, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 7, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 7, 0, 0, 0, 0 }, //  
     { 7, 26, 10, 2, 25, 46, 0 }, // !
     { 12, 12, 14, 1, 24, 36, 46 }, // "
@@ -5447,7 +5447,7 @@ static const EpdGlyph bookerly_16_boldGlyphs[] = {
     { 13, 17, 15, 1, 24, 56, 10663 }, // ª
     { 18, 13, 19, 1, 15, 59, 10719 }, // «
     { 15, 9, 21, 3, 16, 34, 10778 }, // ¬
-    { 11, 5, 13, 1, 11, 14, 10812 }, // ­
+    { 11, 5, 13, 1, 11, 14, 10812 }, // U+00AD
     { 19, 18, 19, 0, 26, 86, 10826 }, // ®
     { 12, 4, 22, 5, 24, 12, 10912 }, // ¯
     { 13, 12, 17, 2, 23, 39, 10924 }, // °
@@ -5922,11 +5922,11 @@ static const EpdGlyph bookerly_16_boldGlyphs[] = {
     { 0, 0, 10, 0, 0, 0, 73743 }, //  
     { 0, 0, 7, 0, 0, 0, 73743 }, //  
     { 0, 0, 2, 0, 0, 0, 73743 }, //  
-    { 0, 0, 0, 0, 0, 0, 73743 }, // ​
-    { 2, 28, 0, -1, 20, 14, 73743 }, // ‌
-    { 8, 30, 0, -4, 22, 60, 73757 }, // ‍
-    { 12, 31, 0, -6, 23, 93, 73817 }, // ‎
-    { 12, 31, 0, -6, 23, 93, 73910 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 73743 }, // U+200B
+    { 2, 28, 0, -1, 20, 14, 73743 }, // U+200C
+    { 8, 30, 0, -4, 22, 60, 73757 }, // U+200D
+    { 12, 31, 0, -6, 23, 93, 73817 }, // U+200E
+    { 12, 31, 0, -6, 23, 93, 73910 }, // U+200F
     { 11, 5, 13, 1, 11, 14, 74003 }, // ‐
     { 11, 5, 13, 1, 11, 14, 74017 }, // ‑
     { 17, 4, 21, 2, 13, 17, 74031 }, // ‒
@@ -5953,11 +5953,11 @@ static const EpdGlyph bookerly_16_boldGlyphs[] = {
     { 7, 6, 10, 1, 12, 11, 74836 }, // ‧
     { 0, 0, 0, 0, 0, 0, 74847 }, //  
     { 0, 0, 0, 0, 0, 0, 74847 }, //  
-    { 12, 31, 0, -6, 23, 93, 74847 }, // ‪
-    { 12, 31, 0, -6, 23, 93, 74940 }, // ‫
-    { 10, 31, 0, -5, 23, 78, 75033 }, // ‬
-    { 14, 31, 0, -7, 23, 109, 75111 }, // ‭
-    { 14, 31, 0, -7, 23, 109, 75220 }, // ‮
+    { 12, 31, 0, -6, 23, 93, 74847 }, // U+202A
+    { 12, 31, 0, -6, 23, 93, 74940 }, // U+202B
+    { 10, 31, 0, -5, 23, 78, 75033 }, // U+202C
+    { 14, 31, 0, -7, 23, 109, 75111 }, // U+202D
+    { 14, 31, 0, -7, 23, 109, 75220 }, // U+202E
     { 0, 0, 4, 0, 0, 0, 75329 }, //  
     { 44, 27, 46, 1, 25, 297, 75329 }, // ‰
     { 9, 11, 9, 0, 23, 25, 75626 }, // ′
@@ -5980,11 +5980,11 @@ static const EpdGlyph bookerly_16_boldGlyphs[] = {
     { 20, 7, 33, 6, 13, 35, 76825 }, // ⁓
     { 30, 11, 31, 0, 23, 83, 76860 }, // ⁗
     { 0, 0, 7, 0, 0, 0, 76943 }, //  
-    { 0, 0, 0, 0, 0, 0, 76943 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 76943 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 76943 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 76943 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 76943 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 76943 }, // U+2060
+    { 0, 0, 0, 0, 0, 0, 76943 }, // U+2061
+    { 0, 0, 0, 0, 0, 0, 76943 }, // U+2062
+    { 0, 0, 0, 0, 0, 0, 76943 }, // U+2063
+    { 0, 0, 0, 0, 0, 0, 76943 }, // U+2064
     { 19, 23, 21, 1, 23, 110, 76943 }, // ₣
     { 20, 24, 21, 0, 23, 120, 77053 }, // ₤
     { 44, 24, 45, 0, 23, 264, 77173 }, // ₧
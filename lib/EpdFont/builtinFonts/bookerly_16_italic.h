@@ -5162,11 +5162,11 @@ static const uint8_t bookerly_16_italicBitmaps[82412] = {
 };
 
 static const EpdGlyph bookerly_16_italicGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 7, 0, 0, 0, 0 }, // 	
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 7, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 7, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 7, 0, 0, 0, 0 }, //  
     { 10, 26, 10, 1, 25, 65, 0 }, // !
     { 12, 11, 12, 1, 24, 33, 65 }, // "
@@ -5275,7 +5275,7 @@ static const EpdGlyph bookerly_16_italicGlyphs[] = {
     { 13, 16, 14, 1, 24, 52, 10774 }, // ª
     { 16, 13, 17, 1, 15, 52, 10826 }, // «
     { 15, 8, 21, 3, 15, 30, 10878 }, // ¬
-    { 11, 3, 12, 1, 10, 9, 10908 }, // ­
+    { 11, 3, 12, 1, 10, 9, 10908 }, // U+00AD
     { 19, 18, 19, 0, 26, 86, 10917 }, // ®
     { 11, 4, 20, 5, 24, 11, 11003 }, // ¯
     { 12, 11, 17, 3, 23, 33, 11014 }, // °
@@ -5750,11 +5750,11 @@ static const EpdGlyph bookerly_16_italicGlyphs[] = {
     { 0, 0, 9, 0, 0, 0, 71791 }, //  
     { 0, 0, 7, 0, 0, 0, 71791 }, //  
     { 0, 0, 2, 0, 0, 0, 71791 }, //  
-    { 0, 0, 0, 0, 0, 0, 71791 }, // ​
-    { 2, 28, 0, -1, 20, 14, 71791 }, // ‌
-    { 8, 30, 0, -4, 22, 60, 71805 }, // ‍
-    { 12, 31, 0, -6, 23, 93, 71865 }, // ‎
-    { 12, 31, 0, -6, 23, 93, 71958 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 71791 }, // U+200B
+    { 2, 28, 0, -1, 20, 14, 71791 }, // U+200C
+    { 8, 30, 0, -4, 22, 60, 71805 }, // U+200D
+    { 12, 31, 0, -6, 23, 93, 71865 }, // U+200E
+    { 12, 31, 0, -6, 23, 93, 71958 }, // U+200F
     { 11, 3, 12, 1, 10, 9, 72051 }, // ‐
     { 11, 3, 12, 1, 10, 9, 72060 }, // ‑
     { 16, 3, 21, 2, 13, 12, 72069 }, // ‒
@@ -5781,11 +5781,11 @@ static const EpdGlyph bookerly_16_italicGlyphs[] = {
     { 5, 6, 9, 2, 12, 8, 72799 }, // ‧
     { 0, 0, 0, 0, 0, 0, 72807 }, //  
     { 0, 0, 0, 0, 0, 0, 72807 }, //  
-    { 12, 31, 0, -6, 23, 93, 72807 }, // ‪
-    { 12, 31, 0, -6, 23, 93, 72900 }, // ‫
-    { 10, 31, 0, -5, 23, 78, 72993 }, // ‬
-    { 14, 31, 0, -7, 23, 109, 73071 }, // ‭
-    { 14, 31, 0, -7, 23, 109, 73180 }, // ‮
+    { 12, 31, 0, -6, 23, 93, 72807 }, // U+202A
+    { 12, 31, 0, -6, 23, 93, 72900 }, // U+202B
+    { 10, 31, 0, -5, 23, 78, 72993 }, // U+202C
+    { 14, 31, 0, -7, 23, 109, 73071 }, // U+202D
+    { 14, 31, 0, -7, 23, 109, 73180 }, // U+202E
     { 0, 0, 4, 0, 0, 0, 73289 }, //  
     { 41, 26, 45, 2, 24, 267, 73289 }, // ‰
     { 7, 11, 9, 1, 23, 20, 73556 }, // ′
@@ -5808,11 +5808,11 @@ static const EpdGlyph bookerly_16_italicGlyphs[] = {
     { 19, 6, 33, 7, 13, 29, 74716 }, // ⁓
     { 26, 11, 28, 1, 23, 72, 74745 }, // ⁗
     { 0, 0, 7, 0, 0, 0, 74817 }, //  
-    { 0, 0, 0, 0, 0, 0, 74817 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 74817 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 74817 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 74817 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 74817 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 74817 }, // U+2060
+    { 0, 0, 0, 0, 0, 0, 74817 }, // U+2061
+    { 0, 0, 0, 0, 0, 0, 74817 }, // U+2062
+    { 0, 0, 0, 0, 0, 0, 74817 }, // U+2063
+    { 0, 0, 0, 0, 0, 0, 74817 }, // U+2064
     { 21, 23, 21, 0, 23, 121, 74817 }, // ₣
     { 21, 24, 21, -1, 23, 126, 74938 }, // ₤
     { 40, 24, 41, 0, 23, 240, 75064 }, // ₧
@@ -7037,11 +7037,11 @@ static const uint8_t bookerly_18_boldBitmaps[112410] = {
 };
 
 static const EpdGlyph bookerly_18_boldGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 8, 0, 0, 0, 0 }, // 	
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 8, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 8, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 8, 0, 0, 0, 0 }, //  
     { 8, 30, 11, 2, 29, 60, 0 }, // !
     { 14, 14, 16, 1, 28, 49, 60 }, // "
@@ -7150,7 +7150,7 @@ static const EpdGlyph bookerly_18_boldGlyphs[] = {
     { 15, 20, 17, 1, 28, 75, 14009 }, // ª
     { 20, 15, 22, 1, 17, 75, 14084 }, // «
     { 18, 10, 24, 3, 18, 45, 14159 }, // ¬
-    { 13, 5, 14, 1, 12, 17, 14204 }, // ­
+    { 13, 5, 14, 1, 12, 17, 14204 }, // U+00AD
     { 20, 21, 22, 1, 30, 105, 14221 }, // ®
     { 14, 5, 26, 6, 28, 18, 14326 }, // ¯
     { 14, 14, 20, 3, 27, 49, 14344 }, // °
@@ -7625,11 +7625,11 @@ static const EpdGlyph bookerly_18_boldGlyphs[] = {
     { 0, 0, 11, 0, 0, 0, 97405 }, //  
     { 0, 0, 8, 0, 0, 0, 97405 }, //  
     { 0, 0, 2, 0, 0, 0, 97405 }, //  
-    { 0, 0, 0, 0, 0, 0, 97405 }, // ​
-    { 2, 31, 0, -1, 22, 16, 97405 }, // ‌
-    { 8, 34, 0, -4, 25, 68, 97421 }, // ‍
-    { 14, 36, 0, -7, 27, 126, 97489 }, // ‎
-    { 14, 36, 0, -7, 27, 126, 97615 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 97405 }, // U+200B
+    { 2, 31, 0, -1, 22, 16, 97405 }, // U+200C
+    { 8, 34, 0, -4, 25, 68, 97421 }, // U+200D
+    { 14, 36, 0, -7, 27, 126, 97489 }, // U+200E
+    { 14, 36, 0, -7, 27, 126, 97615 }, // U+200F
     { 13, 5, 14, 1, 12, 17, 97741 }, // ‐
     { 13, 5, 14, 1, 12, 17, 97758 }, // ‑
     { 19, 5, 24, 2, 15, 24, 97775 }, // ‒
@@ -7656,11 +7656,11 @@ static const EpdGlyph bookerly_18_boldGlyphs[] = {
     { 7, 7, 11, 2, 14, 13, 98793 }, // ‧
     { 0, 0, 0, 0, 0, 0, 98806 }, //  
     { 0, 0, 0, 0, 0, 0, 98806 }, //  
-    { 14, 36, 0, -7, 27, 126, 98806 }, // ‪
-    { 14, 36, 0, -7, 27, 126, 98932 }, // ‫
-    { 12, 35, 0, -6, 26, 105, 99058 }, // ‬
-    { 16, 36, 0, -8, 27, 144, 99163 }, // ‭
-    { 16, 36, 0, -8, 27, 144, 99307 }, // ‮
+    { 14, 36, 0, -7, 27, 126, 98806 }, // U+202A
+    { 14, 36, 0, -7, 27, 126, 98932 }, // U+202B
+    { 12, 35, 0, -6, 26, 105, 99058 }, // U+202C
+    { 16, 36, 0, -8, 27, 144, 99163 }, // U+202D
+    { 16, 36, 0, -8, 27, 144, 99307 }, // U+202E
     { 0, 0, 4, 0, 0, 0, 99451 }, //  
     { 51, 30, 53, 1, 28, 383, 99451 }, // ‰
     { 9, 13, 10, 1, 27, 30, 99834 }, // ′
@@ -7683,11 +7683,11 @@ static const EpdGlyph bookerly_18_boldGlyphs[] = {
     { 23, 8, 38, 7, 15, 46, 101410 }, // ⁓
     { 34, 13, 35, 1, 27, 111, 101456 }, // ⁗
     { 0, 0, 8, 0, 0, 0, 101567 }, //  
-    { 0, 0, 0, 0, 0, 0, 101567 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 101567 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 101567 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 101567 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 101567 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 101567 }, // U+2060
+    { 0, 0, 0, 0, 0, 0, 101567 }, // U+2061
+    { 0, 0, 0, 0, 0, 0, 101567 }, // U+2062
+    { 0, 0, 0, 0, 0, 0, 101567 }, // U+2063
+    { 0, 0, 0, 0, 0, 0, 101567 }, // U+2064
     { 22, 26, 24, 1, 26, 143, 101567 }, // ₣
     { 22, 28, 24, 1, 27, 154, 101710 }, // ₤
     { 50, 28, 52, 1, 27, 350, 101864 }, // ₧
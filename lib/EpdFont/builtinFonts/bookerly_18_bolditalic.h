@@ -7245,11 +7245,11 @@ static const uint8_t bookerly_18_bolditalicBitmaps[115736] = {
 };
 
 static const EpdGlyph bookerly_18_bolditalicGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 8, 0, 0, 0, 0 }, // 	
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 8, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 8, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 8, 0, 0, 0, 0 }, //  
     { 12, 30, 13, 1, 29, 90, 0 }, // !
     { 14, 14, 15, 2, 28, 49, 90 }, // "
@@ -7358,7 +7358,7 @@ static const EpdGlyph bookerly_18_bolditalicGlyphs[] = {
     { 16, 20, 17, 1, 28, 80, 15077 }, // ª
     { 21, 15, 23, 1, 17, 79, 15157 }, // «
     { 18, 10, 24, 3, 18, 45, 15236 }, // ¬
-    { 13, 5, 15, 1, 12, 17, 15281 }, // ­
+    { 13, 5, 15, 1, 12, 17, 15281 }, // U+00AD
     { 20, 21, 22, 1, 30, 105, 15298 }, // ®
     { 13, 5, 24, 5, 28, 17, 15403 }, // ¯
     { 14, 14, 20, 3, 27, 49, 15420 }, // °
@@ -7833,11 +7833,11 @@ static const EpdGlyph bookerly_18_bolditalicGlyphs[] = {
     { 0, 0, 12, 0, 0, 0, 100576 }, //  
     { 0, 0, 8, 0, 0, 0, 100576 }, //  
     { 0, 0, 2, 0, 0, 0, 100576 }, //  
-    { 0, 0, 0, 0, 0, 0, 100576 }, // ​
-    { 2, 31, 0, -1, 22, 16, 100576 }, // ‌
-    { 8, 34, 0, -4, 25, 68, 100592 }, // ‍
-    { 14, 36, 0, -7, 27, 126, 100660 }, // ‎
-    { 14, 36, 0, -7, 27, 126, 100786 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 100576 }, // U+200B
+    { 2, 31, 0, -1, 22, 16, 100576 }, // U+200C
+    { 8, 34, 0, -4, 25, 68, 100592 }, // U+200D
+    { 14, 36, 0, -7, 27, 126, 100660 }, // U+200E
+    { 14, 36, 0, -7, 27, 126, 100786 }, // U+200F
     { 13, 5, 15, 1, 12, 17, 100912 }, // ‐
     { 13, 5, 15, 1, 12, 17, 100929 }, // ‑
     { 19, 5, 24, 2, 15, 24, 100946 }, // ‒
@@ -7864,11 +7864,11 @@ static const EpdGlyph bookerly_18_bolditalicGlyphs[] = {
     { 7, 7, 11, 2, 14, 13, 102010 }, // ‧
     { 0, 0, 0, 0, 0, 0, 102023 }, //  
     { 0, 0, 0, 0, 0, 0, 102023 }, //  
-    { 14, 36, 0, -7, 27, 126, 102023 }, // ‪
-    { 14, 36, 0, -7, 27, 126, 102149 }, // ‫
-    { 12, 35, 0, -6, 26, 105, 102275 }, // ‬
-    { 16, 36, 0, -8, 27, 144, 102380 }, // ‭
-    { 16, 36, 0, -8, 27, 144, 102524 }, // ‮
+    { 14, 36, 0, -7, 27, 126, 102023 }, // U+202A
+    { 14, 36, 0, -7, 27, 126, 102149 }, // U+202B
+    { 12, 35, 0, -6, 26, 105, 102275 }, // U+202C
+    { 16, 36, 0, -8, 27, 144, 102380 }, // U+202D
+    { 16, 36, 0, -8, 27, 144, 102524 }, // U+202E
     { 0, 0, 4, 0, 0, 0, 102668 }, //  
     { 51, 31, 54, 1, 28, 396, 102668 }, // ‰
     { 8, 13, 10, 1, 27, 26, 103064 }, // ′
@@ -7891,11 +7891,11 @@ static const EpdGlyph bookerly_18_bolditalicGlyphs[] = {
     { 23, 8, 38, 7, 15, 46, 104644 }, // ⁓
     { 33, 13, 35, 1, 27, 108, 104690 }, // ⁗
     { 0, 0, 8, 0, 0, 0, 104798 }, //  
-    { 0, 0, 0, 0, 0, 0, 104798 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 104798 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 104798 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 104798 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 104798 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 104798 }, // U+2060
+    { 0, 0, 0, 0, 0, 0, 104798 }, // U+2061
+    { 0, 0, 0, 0, 0, 0, 104798 }, // U+2062
+    { 0, 0, 0, 0, 0, 0, 104798 }, // U+2063
+    { 0, 0, 0, 0, 0, 0, 104798 }, // U+2064
     { 25, 26, 24, -1, 26, 163, 104798 }, // ₣
     { 25, 28, 24, -1, 27, 175, 104961 }, // ₤
     { 49, 28, 50, 0, 27, 343, 105136 }, // ₧
@@ -6763,11 +6763,11 @@ static const uint8_t bookerly_18_italicBitmaps[108017] = {
 };
 
 static const EpdGlyph bookerly_18_italicGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 8, 0, 0, 0, 0 }, // 	
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 8, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 8, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 8, 0, 0, 0, 0 }, //  
     { 10, 30, 12, 2, 29, 75, 0 }, // !
     { 13, 13, 14, 2, 28, 43, 75 }, // "
@@ -6876,7 +6876,7 @@ static const EpdGlyph bookerly_18_italicGlyphs[] = {
     { 15, 18, 16, 1, 27, 68, 14091 }, // ª
     { 18, 15, 20, 1, 17, 68, 14159 }, // «
     { 17, 9, 24, 3, 18, 39, 14227 }, // ¬
-    { 12, 4, 14, 1, 12, 12, 14266 }, // ­
+    { 12, 4, 14, 1, 12, 12, 14266 }, // U+00AD
     { 20, 21, 22, 1, 30, 105, 14278 }, // ®
     { 13, 3, 23, 5, 27, 10, 14383 }, // ¯
     { 14, 13, 20, 3, 27, 46, 14393 }, // °
@@ -7351,11 +7351,11 @@ static const EpdGlyph bookerly_18_italicGlyphs[] = {
     { 0, 0, 10, 0, 0, 0, 94073 }, //  
     { 0, 0, 8, 0, 0, 0, 94073 }, //  
     { 0, 0, 2, 0, 0, 0, 94073 }, //  
-    { 0, 0, 0, 0, 0, 0, 94073 }, // ​
-    { 2, 31, 0, -1, 22, 16, 94073 }, // ‌
-    { 8, 34, 0, -4, 25, 68, 94089 }, // ‍
-    { 14, 36, 0, -7, 27, 126, 94157 }, // ‎
-    { 14, 36, 0, -7, 27, 126, 94283 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 94073 }, // U+200B
+    { 2, 31, 0, -1, 22, 16, 94073 }, // U+200C
+    { 8, 34, 0, -4, 25, 68, 94089 }, // U+200D
+    { 14, 36, 0, -7, 27, 126, 94157 }, // U+200E
+    { 14, 36, 0, -7, 27, 126, 94283 }, // U+200F
     { 12, 4, 14, 1, 12, 12, 94409 }, // ‐
     { 12, 4, 14, 1, 12, 12, 94421 }, // ‑
     { 18, 4, 24, 3, 15, 18, 94433 }, // ‒
@@ -7382,11 +7382,11 @@ static const EpdGlyph bookerly_18_italicGlyphs[] = {
     { 6, 6, 10, 2, 13, 9, 95395 }, // ‧
     { 0, 0, 0, 0, 0, 0, 95404 }, //  
     { 0, 0, 0, 0, 0, 0, 95404 }, //  
-    { 14, 36, 0, -7, 27, 126, 95404 }, // ‪
-    { 14, 36, 0, -7, 27, 126, 95530 }, // ‫
-    { 12, 35, 0, -6, 26, 105, 95656 }, // ‬
-    { 16, 36, 0, -8, 27, 144, 95761 }, // ‭
-    { 16, 36, 0, -8, 27, 144, 95905 }, // ‮
+    { 14, 36, 0, -7, 27, 126, 95404 }, // U+202A
+    { 14, 36, 0, -7, 27, 126, 95530 }, // U+202B
+    { 12, 35, 0, -6, 26, 105, 95656 }, // U+202C
+    { 16, 36, 0, -8, 27, 144, 95761 }, // U+202D
+    { 16, 36, 0, -8, 27, 144, 95905 }, // U+202E
     { 0, 0, 4, 0, 0, 0, 96049 }, //  
     { 48, 30, 52, 2, 28, 360, 96049 }, // ‰
     { 8, 13, 10, 1, 27, 26, 96409 }, // ′
@@ -7409,11 +7409,11 @@ static const EpdGlyph bookerly_18_italicGlyphs[] = {
     { 22, 6, 38, 8, 14, 33, 97918 }, // ⁓
     { 30, 13, 32, 1, 27, 98, 97951 }, // ⁗
     { 0, 0, 8, 0, 0, 0, 98049 }, //  
-    { 0, 0, 0, 0, 0, 0, 98049 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 98049 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 98049 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 98049 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 98049 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 98049 }, // U+2060
+    { 0, 0, 0, 0, 0, 0, 98049 }, // U+2061
+    { 0, 0, 0, 0, 0, 0, 98049 }, // U+2062
+    { 0, 0, 0, 0, 0, 0, 98049 }, // U+2063
+    { 0, 0, 0, 0, 0, 0, 98049 }, // U+2064
     { 24, 26, 24, 0, 26, 156, 98049 }, // ₣
     { 24, 28, 24, -1, 27, 168, 98205 }, // ₤
     { 46, 28, 48, 0, 27, 322, 98373 }, // ₧
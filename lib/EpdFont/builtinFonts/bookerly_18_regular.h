@@ -6587,11 +6587,11 @@ static const uint8_t bookerly_18_regularBitmaps[105210] = {
 };
 
 static const EpdGlyph bookerly_18_regularGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 8, 0, 0, 0, 0 }, // 	
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 8, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 8, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 8, 0, 0, 0, 0 }, //  
     { 6, 30, 10, 3, 29, 45, 0 }, // !
     { 12, 13, 14, 1, 28, 39, 45 }, // "
@@ -6700,7 +6700,7 @@ static const EpdGlyph bookerly_18_regularGlyphs[] = {
     { 13, 18, 17, 2, 27, 59, 13138 }, // ª
     { 19, 15, 20, 1, 17, 72, 13197 }, // «
     { 17, 9, 24, 3, 18, 39, 13269 }, // ¬
-    { 12, 4, 14, 1, 12, 12, 13308 }, // ­
+    { 12, 4, 14, 1, 12, 12, 13308 }, // U+00AD
     { 20, 21, 22, 1, 30, 105, 13320 }, // ®
     { 13, 4, 26, 6, 28, 13, 13425 }, // ¯
     { 14, 13, 20, 3, 27, 46, 13438 }, // °
@@ -7175,11 +7175,11 @@ static const EpdGlyph bookerly_18_regularGlyphs[] = {
     { 0, 0, 10, 0, 0, 0, 91447 }, //  
     { 0, 0, 8, 0, 0, 0, 91447 }, //  
     { 0, 0, 2, 0, 0, 0, 91447 }, //  
-    { 0, 0, 0, 0, 0, 0, 91447 }, // ​
-    { 2, 31, 0, -1, 22, 16, 91447 }, // ‌
-    { 8, 34, 0, -4, 25, 68, 91463 }, // ‍
-    { 14, 36, 0, -7, 27, 126, 91531 }, // ‎
-    { 14, 36, 0, -7, 27, 126, 91657 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 91447 }, // U+200B
+    { 2, 31, 0, -1, 22, 16, 91447 }, // U+200C
+    { 8, 34, 0, -4, 25, 68, 91463 }, // U+200D
+    { 14, 36, 0, -7, 27, 126, 91531 }, // U+200E
+    { 14, 36, 0, -7, 27, 126, 91657 }, // U+200F
     { 12, 4, 14, 1, 12, 12, 91783 }, // ‐
     { 12, 4, 14, 1, 12, 12, 91795 }, // ‑
     { 18, 4, 24, 3, 15, 18, 91807 }, // ‒
@@ -7206,11 +7206,11 @@ static const EpdGlyph bookerly_18_regularGlyphs[] = {
     { 6, 6, 10, 2, 13, 9, 92747 }, // ‧
     { 0, 0, 0, 0, 0, 0, 92756 }, //  
     { 0, 0, 0, 0, 0, 0, 92756 }, //  
-    { 14, 36, 0, -7, 27, 126, 92756 }, // ‪
-    { 14, 36, 0, -7, 27, 126, 92882 }, // ‫
-    { 12, 35, 0, -6, 26, 105, 93008 }, // ‬
-    { 16, 36, 0, -8, 27, 144, 93113 }, // ‭
-    { 16, 36, 0, -8, 27, 144, 93257 }, // ‮
+    { 14, 36, 0, -7, 27, 126, 92756 }, // U+202A
+    { 14, 36, 0, -7, 27, 126, 92882 }, // U+202B
+    { 12, 35, 0, -6, 26, 105, 93008 }, // U+202C
+    { 16, 36, 0, -8, 27, 144, 93113 }, // U+202D
+    { 16, 36, 0, -8, 27, 144, 93257 }, // U+202E
     { 0, 0, 4, 0, 0, 0, 93401 }, //  
     { 49, 30, 52, 2, 28, 368, 93401 }, // ‰
     { 8, 13, 10, 1, 27, 26, 93769 }, // ′
@@ -7233,11 +7233,11 @@ static const EpdGlyph bookerly_18_regularGlyphs[] = {
     { 22, 6, 38, 8, 14, 33, 95222 }, // ⁓
     { 30, 13, 32, 1, 27, 98, 95255 }, // ⁗
     { 0, 0, 8, 0, 0, 0, 95353 }, //  
-    { 0, 0, 0, 0, 0, 0, 95353 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 95353 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 95353 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 95353 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 95353 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 95353 }, // U+2060
+    { 0, 0, 0, 0, 0, 0, 95353 }, // U+2061
+    { 0, 0, 0, 0, 0, 0, 95353 }, // U+2062
+    { 0, 0, 0, 0, 0, 0, 95353 }, // U+2063
+    { 0, 0, 0, 0, 0, 0, 95353 }, // U+2064
     { 19, 26, 24, 2, 26, 124, 95353 }, // ₣
     { 21, 28, 24, 1, 27, 147, 95477 }, // ₤
     { 45, 28, 48, 1, 27, 315, 95624 }, // ₧
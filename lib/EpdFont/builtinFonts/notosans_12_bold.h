@@ -3114,8 +3114,8 @@ static const uint8_t notosans_12_boldBitmaps[49639] = {
 };
 
 static const EpdGlyph notosans_12_boldGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 7, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 7, 0, 0, 0, 0 }, //  
     { 5, 19, 7, 1, 18, 24, 0 }, // !
     { 10, 7, 12, 1, 18, 18, 24 }, // "
@@ -3224,7 +3224,7 @@ static const EpdGlyph notosans_12_boldGlyphs[] = {
     { 9, 10, 10, 0, 19, 23, 5651 }, // ª
     { 15, 12, 15, 0, 13, 45, 5674 }, // «
     { 13, 8, 14, 1, 11, 26, 5719 }, // ¬
-    { 8, 4, 8, 0, 9, 8, 5745 }, // ­
+    { 8, 4, 8, 0, 9, 8, 5745 }, // U+00AD
     { 19, 20, 21, 1, 19, 95, 5753 }, // ®
     { 14, 3, 13, -1, 22, 11, 5848 }, // ¯
     { 9, 10, 11, 1, 19, 23, 5859 }, // °
@@ -3814,11 +3814,11 @@ static const EpdGlyph notosans_12_boldGlyphs[] = {
     { 0, 0, 7, 0, 0, 0, 43354 }, //  
     { 0, 0, 4, 0, 0, 0, 43354 }, //  
     { 0, 0, 3, 0, 0, 0, 43354 }, //  
-    { 0, 0, 0, 0, 0, 0, 43354 }, // ​
-    { 0, 0, 0, 0, 0, 0, 43354 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 43354 }, // ‍
-    { 7, 22, 0, -1, 18, 39, 43354 }, // ‎
-    { 7, 22, 0, -6, 18, 39, 43393 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 43354 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 43354 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 43354 }, // U+200D
+    { 7, 22, 0, -1, 18, 39, 43354 }, // U+200E
+    { 7, 22, 0, -6, 18, 39, 43393 }, // U+200F
     { 8, 4, 8, 0, 9, 8, 43432 }, // ‐
     { 8, 4, 8, 0, 9, 8, 43440 }, // ‑
     { 13, 4, 14, 1, 11, 13, 43448 }, // ‒
@@ -3845,11 +3845,11 @@ static const EpdGlyph notosans_12_boldGlyphs[] = {
     { 5, 5, 7, 1, 9, 7, 43922 }, // ‧
     { 0, 0, 15, 0, 0, 0, 43929 }, //  
     { 0, 0, 15, 0, 0, 0, 43929 }, //  
-    { 7, 20, 0, -1, 16, 35, 43929 }, // ‪
-    { 7, 20, 0, -6, 16, 35, 43964 }, // ‫
-    { 6, 22, 0, -3, 18, 33, 43999 }, // ‬
-    { 6, 22, 0, -3, 18, 33, 44032 }, // ‭
-    { 6, 22, 0, -3, 18, 33, 44065 }, // ‮
+    { 7, 20, 0, -1, 16, 35, 43929 }, // U+202A
+    { 7, 20, 0, -6, 16, 35, 43964 }, // U+202B
+    { 6, 22, 0, -3, 18, 33, 43999 }, // U+202C
+    { 6, 22, 0, -3, 18, 33, 44032 }, // U+202D
+    { 6, 22, 0, -3, 18, 33, 44065 }, // U+202E
     { 0, 0, 4, 0, 0, 0, 44098 }, //  
     { 32, 20, 32, 0, 19, 160, 44098 }, // ‰
     { 41, 20, 42, 0, 19, 205, 44258 }, // ‱
@@ -3899,21 +3899,21 @@ static const EpdGlyph notosans_12_boldGlyphs[] = {
     { 5, 20, 7, 1, 19, 25, 46735 }, // ⁝
     { 5, 20, 7, 1, 19, 25, 46760 }, // ⁞
     { 0, 0, 6, 0, 0, 0, 46785 }, //  
-    { 0, 0, 15, 0, 0, 0, 46785 }, // ⁠
-    { 0, 0, 15, 0, 0, 0, 46785 }, // ⁡
-    { 0, 0, 15, 0, 0, 0, 46785 }, // ⁢
-    { 0, 0, 15, 0, 0, 0, 46785 }, // ⁣
-    { 0, 0, 15, 0, 0, 0, 46785 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 46785 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 46785 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 46785 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 46785 }, // ⁩
-    { 6, 22, 0, -3, 18, 33, 46785 }, // ⁪
-    { 6, 22, 0, -3, 18, 33, 46818 }, // ⁫
-    { 6, 22, 0, -3, 18, 33, 46851 }, // ⁬
-    { 6, 22, 0, -3, 18, 33, 46884 }, // ⁭
-    { 6, 22, 0, -3, 18, 33, 46917 }, // ⁮
-    { 6, 22, 0, -3, 18, 33, 46950 }, // ⁯
+    { 0, 0, 15, 0, 0, 0, 46785 }, // U+2060
+    { 0, 0, 15, 0, 0, 0, 46785 }, // U+2061
+    { 0, 0, 15, 0, 0, 0, 46785 }, // U+2062
+    { 0, 0, 15, 0, 0, 0, 46785 }, // U+2063
+    { 0, 0, 15, 0, 0, 0, 46785 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 46785 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 46785 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 46785 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 46785 }, // U+2069
+    { 6, 22, 0, -3, 18, 33, 46785 }, // U+206A
+    { 6, 22, 0, -3, 18, 33, 46818 }, // U+206B
+    { 6, 22, 0, -3, 18, 33, 46851 }, // U+206C
+    { 6, 22, 0, -3, 18, 33, 46884 }, // U+206D
+    { 6, 22, 0, -3, 18, 33, 46917 }, // U+206E
+    { 6, 22, 0, -3, 18, 33, 46950 }, // U+206F
     { 14, 19, 14, 0, 19, 67, 46983 }, // ₠
     { 15, 21, 15, 0, 19, 79, 47050 }, // ₡
     { 14, 20, 14, 0, 19, 70, 47129 }, // ₢
@@ -3315,8 +3315,8 @@ static const uint8_t notosans_12_bolditalicBitmaps[52863] = {
 };
 
 static const EpdGlyph notosans_12_bolditalicGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 7, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 7, 0, 0, 0, 0 }, //  
     { 8, 19, 7, 0, 18, 38, 0 }, // !
     { 10, 7, 11, 2, 18, 18, 38 }, // "
@@ -3425,7 +3425,7 @@ static const EpdGlyph notosans_12_bolditalicGlyphs[] = {
     { 10, 10, 9, 1, 19, 25, 6209 }, // ª
     { 15, 12, 14, 0, 13, 45, 6234 }, // «
     { 13, 8, 14, 1, 11, 26, 6279 }, // ¬
-    { 8, 4, 8, 0, 9, 8, 6305 }, // ­
+    { 8, 4, 8, 0, 9, 8, 6305 }, // U+00AD
     { 19, 20, 21, 1, 19, 95, 6313 }, // ®
     { 12, 4, 11, 2, 22, 12, 6408 }, // ¯
     { 9, 10, 11, 1, 19, 23, 6420 }, // °
@@ -4015,11 +4015,11 @@ static const EpdGlyph notosans_12_bolditalicGlyphs[] = {
     { 0, 0, 7, 0, 0, 0, 46332 }, //  
     { 0, 0, 4, 0, 0, 0, 46332 }, //  
     { 0, 0, 3, 0, 0, 0, 46332 }, //  
-    { 0, 0, 0, 0, 0, 0, 46332 }, // ​
-    { 0, 0, 0, 0, 0, 0, 46332 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 46332 }, // ‍
-    { 7, 22, 0, -1, 18, 39, 46332 }, // ‎
-    { 7, 22, 0, -6, 18, 39, 46371 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 46332 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 46332 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 46332 }, // U+200D
+    { 7, 22, 0, -1, 18, 39, 46332 }, // U+200E
+    { 7, 22, 0, -6, 18, 39, 46371 }, // U+200F
     { 8, 4, 8, 0, 9, 8, 46410 }, // ‐
     { 8, 4, 8, 0, 9, 8, 46418 }, // ‑
     { 14, 4, 14, 0, 11, 14, 46426 }, // ‒
@@ -4046,11 +4046,11 @@ static const EpdGlyph notosans_12_bolditalicGlyphs[] = {
     { 6, 5, 8, 1, 9, 8, 46915 }, // ‧
     { 0, 0, 15, 0, 0, 0, 46923 }, //  
     { 0, 0, 15, 0, 0, 0, 46923 }, //  
-    { 7, 20, 0, -1, 16, 35, 46923 }, // ‪
-    { 7, 20, 0, -6, 16, 35, 46958 }, // ‫
-    { 6, 22, 0, -3, 18, 33, 46993 }, // ‬
-    { 6, 22, 0, -3, 18, 33, 47026 }, // ‭
-    { 6, 22, 0, -3, 18, 33, 47059 }, // ‮
+    { 7, 20, 0, -1, 16, 35, 46923 }, // U+202A
+    { 7, 20, 0, -6, 16, 35, 46958 }, // U+202B
+    { 6, 22, 0, -3, 18, 33, 46993 }, // U+202C
+    { 6, 22, 0, -3, 18, 33, 47026 }, // U+202D
+    { 6, 22, 0, -3, 18, 33, 47059 }, // U+202E
     { 0, 0, 4, 0, 0, 0, 47092 }, //  
     { 29, 20, 30, 1, 19, 145, 47092 }, // ‰
     { 38, 20, 40, 1, 19, 190, 47237 }, // ‱
@@ -4100,21 +4100,21 @@ static const EpdGlyph notosans_12_bolditalicGlyphs[] = {
     { 5, 20, 7, 1, 19, 25, 49849 }, // ⁝
     { 5, 20, 7, 1, 19, 25, 49874 }, // ⁞
     { 0, 0, 6, 0, 0, 0, 49899 }, //  
-    { 0, 0, 15, 0, 0, 0, 49899 }, // ⁠
-    { 0, 0, 15, 0, 0, 0, 49899 }, // ⁡
-    { 0, 0, 15, 0, 0, 0, 49899 }, // ⁢
-    { 0, 0, 15, 0, 0, 0, 49899 }, // ⁣
-    { 0, 0, 15, 0, 0, 0, 49899 }, // ⁤
-    { 0, 0, 15, 0, 0, 0, 49899 }, // ⁦
-    { 0, 0, 15, 0, 0, 0, 49899 }, // ⁧
-    { 0, 0, 15, 0, 0, 0, 49899 }, // ⁨
-    { 0, 0, 15, 0, 0, 0, 49899 }, // ⁩
-    { 6, 22, 0, -3, 18, 33, 49899 }, // ⁪
-    { 6, 22, 0, -3, 18, 33, 49932 }, // ⁫
-    { 6, 22, 0, -3, 18, 33, 49965 }, // ⁬
-    { 6, 22, 0, -3, 18, 33, 49998 }, // ⁭
-    { 6, 22, 0, -3, 18, 33, 50031 }, // ⁮
-    { 6, 22, 0, -3, 18, 33, 50064 }, // ⁯
+    { 0, 0, 15, 0, 0, 0, 49899 }, // U+2060
+    { 0, 0, 15, 0, 0, 0, 49899 }, // U+2061
+    { 0, 0, 15, 0, 0, 0, 49899 }, // U+2062
+    { 0, 0, 15, 0, 0, 0, 49899 }, // U+2063
+    { 0, 0, 15, 0, 0, 0, 49899 }, // U+2064
+    { 0, 0, 15, 0, 0, 0, 49899 }, // U+2066
+    { 0, 0, 15, 0, 0, 0, 49899 }, // U+2067
+    { 0, 0, 15, 0, 0, 0, 49899 }, // U+2068
+    { 0, 0, 15, 0, 0, 0, 49899 }, // U+2069
+    { 6, 22, 0, -3, 18, 33, 49899 }, // U+206A
+    { 6, 22, 0, -3, 18, 33, 49932 }, // U+206B
+    { 6, 22, 0, -3, 18, 33, 49965 }, // U+206C
+    { 6, 22, 0, -3, 18, 33, 49998 }, // U+206D
+    { 6, 22, 0, -3, 18, 33, 50031 }, // U+206E
+    { 6, 22, 0, -3, 18, 33, 50064 }, // U+206F
     { 14, 19, 14, 1, 19, 67, 50097 }, // ₠
     { 16, 21, 14, 0, 19, 84, 50164 }, // ₡
     { 16, 20, 14, 0, 19, 80, 50248 }, // ₢
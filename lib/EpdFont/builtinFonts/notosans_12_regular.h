@@ -2834,8 +2834,8 @@ static const uint8_t notosans_12_regularBitmaps[45168] = {
 };
 
 static const EpdGlyph notosans_12_regularGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 7, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 7, 0, 0, 0, 0 }, //  
     { 4, 19, 7, 1, 18, 19, 0 }, // !
     { 8, 7, 10, 1, 18, 14, 19 }, // "
@@ -2944,7 +2944,7 @@ static const EpdGlyph notosans_12_regularGlyphs[] = {
     { 8, 10, 9, 0, 19, 20, 5196 }, // ª
     { 11, 11, 13, 1, 12, 31, 5216 }, // «
     { 12, 7, 14, 1, 10, 21, 5247 }, // ¬
-    { 7, 3, 8, 1, 8, 6, 5268 }, // ­
+    { 7, 3, 8, 1, 8, 6, 5268 }, // U+00AD
     { 19, 20, 21, 1, 19, 95, 5274 }, // ®
     { 14, 2, 13, -1, 21, 7, 5369 }, // ¯
     { 9, 9, 11, 1, 19, 21, 5376 }, // °
@@ -3534,11 +3534,11 @@ static const EpdGlyph notosans_12_regularGlyphs[] = {
     { 0, 0, 7, 0, 0, 0, 39341 }, //  
     { 0, 0, 4, 0, 0, 0, 39341 }, //  
     { 0, 0, 3, 0, 0, 0, 39341 }, //  
-    { 0, 0, 0, 0, 0, 0, 39341 }, // ​
-    { 0, 0, 0, 0, 0, 0, 39341 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 39341 }, // ‍
-    { 7, 22, 0, -1, 18, 39, 39341 }, // ‎
-    { 7, 22, 0, -6, 18, 39, 39380 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 39341 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 39341 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 39341 }, // U+200D
+    { 7, 22, 0, -1, 18, 39, 39341 }, // U+200E
+    { 7, 22, 0, -6, 18, 39, 39380 }, // U+200F
     { 7, 3, 8, 1, 8, 6, 39419 }, // ‐
     { 7, 3, 8, 1, 8, 6, 39425 }, // ‑
     { 13, 2, 14, 1, 10, 7, 39431 }, // ‒
@@ -3565,11 +3565,11 @@ static const EpdGlyph notosans_12_regularGlyphs[] = {
     { 4, 5, 7, 1, 9, 5, 39831 }, // ‧
     { 0, 0, 15, 0, 0, 0, 39836 }, //  
     { 0, 0, 15, 0, 0, 0, 39836 }, //  
-    { 7, 20, 0, -1, 16, 35, 39836 }, // ‪
-    { 7, 20, 0, -6, 16, 35, 39871 }, // ‫
-    { 6, 22, 0, -3, 18, 33, 39906 }, // ‬
-    { 6, 22, 0, -3, 18, 33, 39939 }, // ‭
-    { 6, 22, 0, -3, 18, 33, 39972 }, // ‮
+    { 7, 20, 0, -1, 16, 35, 39836 }, // U+202A
+    { 7, 20, 0, -6, 16, 35, 39871 }, // U+202B
+    { 6, 22, 0, -3, 18, 33, 39906 }, // U+202C
+    { 6, 22, 0, -3, 18, 33, 39939 }, // U+202D
+    { 6, 22, 0, -3, 18, 33, 39972 }, // U+202E
     { 0, 0, 4, 0, 0, 0, 40005 }, //  
     { 28, 20, 29, 1, 19, 140, 40005 }, // ‰
     { 37, 20, 39, 1, 19, 185, 40145 }, // ‱
@@ -3619,21 +3619,21 @@ static const EpdGlyph notosans_12_regularGlyphs[] = {
     { 4, 19, 7, 1, 18, 19, 42430 }, // ⁝
     { 4, 20, 7, 1, 19, 20, 42449 }, // ⁞
     { 0, 0, 6, 0, 0, 0, 42469 }, //  
-    { 0, 0, 15, 0, 0, 0, 42469 }, // ⁠
-    { 0, 0, 15, 0, 0, 0, 42469 }, // ⁡
-    { 0, 0, 15, 0, 0, 0, 42469 }, // ⁢
-    { 0, 0, 15, 0, 0, 0, 42469 }, // ⁣
-    { 0, 0, 15, 0, 0, 0, 42469 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 42469 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 42469 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 42469 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 42469 }, // ⁩
-    { 6, 22, 0, -3, 18, 33, 42469 }, // ⁪
-    { 6, 22, 0, -3, 18, 33, 42502 }, // ⁫
-    { 6, 22, 0, -3, 18, 33, 42535 }, // ⁬
-    { 6, 22, 0, -3, 18, 33, 42568 }, // ⁭
-    { 6, 22, 0, -3, 18, 33, 42601 }, // ⁮
-    { 6, 22, 0, -3, 18, 33, 42634 }, // ⁯
+    { 0, 0, 15, 0, 0, 0, 42469 }, // U+2060
+    { 0, 0, 15, 0, 0, 0, 42469 }, // U+2061
+    { 0, 0, 15, 0, 0, 0, 42469 }, // U+2062
+    { 0, 0, 15, 0, 0, 0, 42469 }, // U+2063
+    { 0, 0, 15, 0, 0, 0, 42469 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 42469 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 42469 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 42469 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 42469 }, // U+2069
+    { 6, 22, 0, -3, 18, 33, 42469 }, // U+206A
+    { 6, 22, 0, -3, 18, 33, 42502 }, // U+206B
+    { 6, 22, 0, -3, 18, 33, 42535 }, // U+206C
+    { 6, 22, 0, -3, 18, 33, 42568 }, // U+206D
+    { 6, 22, 0, -3, 18, 33, 42601 }, // U+206E
+    { 6, 22, 0, -3, 18, 33, 42634 }, // U+206F
     { 14, 19, 14, 0, 19, 67, 42667 }, // ₠
     { 13, 21, 14, 1, 19, 69, 42734 }, // ₡
     { 13, 20, 14, 1, 19, 65, 42803 }, // ₢
@@ -4082,8 +4082,8 @@ static const uint8_t notosans_14_italicBitmaps[65135] = {
 };
 
 static const EpdGlyph notosans_14_italicGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 8, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 8, 0, 0, 0, 0 }, //  
     { 9, 22, 8, 0, 21, 50, 0 }, // !
     { 10, 8, 11, 3, 21, 20, 50 }, // "
@@ -4192,7 +4192,7 @@ static const EpdGlyph notosans_14_italicGlyphs[] = {
     { 10, 11, 10, 2, 22, 28, 7675 }, // ª
     { 13, 13, 14, 1, 14, 43, 7703 }, // «
     { 14, 9, 17, 2, 12, 32, 7746 }, // ¬
-    { 9, 3, 9, 0, 9, 7, 7778 }, // ­
+    { 9, 3, 9, 0, 9, 7, 7778 }, // U+00AD
     { 22, 23, 24, 1, 22, 127, 7785 }, // ®
     { 13, 3, 11, 2, 25, 10, 7912 }, // ¯
     { 10, 10, 12, 1, 22, 25, 7922 }, // °
@@ -4782,11 +4782,11 @@ static const EpdGlyph notosans_14_italicGlyphs[] = {
     { 0, 0, 7, 0, 0, 0, 57011 }, //  
     { 0, 0, 5, 0, 0, 0, 57011 }, //  
     { 0, 0, 3, 0, 0, 0, 57011 }, //  
-    { 0, 0, 0, 0, 0, 0, 57011 }, // ​
-    { 0, 0, 0, 0, 0, 0, 57011 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 57011 }, // ‍
-    { 8, 25, 0, -1, 21, 50, 57011 }, // ‎
-    { 8, 25, 0, -7, 21, 50, 57061 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 57011 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 57011 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 57011 }, // U+200D
+    { 8, 25, 0, -1, 21, 50, 57011 }, // U+200E
+    { 8, 25, 0, -7, 21, 50, 57061 }, // U+200F
     { 9, 3, 9, 0, 9, 7, 57111 }, // ‐
     { 9, 3, 9, 0, 9, 7, 57118 }, // ‑
     { 15, 3, 16, 1, 12, 12, 57125 }, // ‒
@@ -4813,11 +4813,11 @@ static const EpdGlyph notosans_14_italicGlyphs[] = {
     { 5, 5, 7, 1, 10, 7, 57677 }, // ‧
     { 0, 0, 18, 0, 0, 0, 57684 }, //  
     { 0, 0, 18, 0, 0, 0, 57684 }, //  
-    { 8, 22, 0, -1, 18, 44, 57684 }, // ‪
-    { 8, 22, 0, -7, 18, 44, 57728 }, // ‫
-    { 8, 25, 0, -4, 21, 50, 57772 }, // ‬
-    { 8, 25, 0, -4, 21, 50, 57822 }, // ‭
-    { 8, 25, 0, -4, 21, 50, 57872 }, // ‮
+    { 8, 22, 0, -1, 18, 44, 57684 }, // U+202A
+    { 8, 22, 0, -7, 18, 44, 57728 }, // U+202B
+    { 8, 25, 0, -4, 21, 50, 57772 }, // U+202C
+    { 8, 25, 0, -4, 21, 50, 57822 }, // U+202D
+    { 8, 25, 0, -4, 21, 50, 57872 }, // U+202E
     { 0, 0, 5, 0, 0, 0, 57922 }, //  
     { 30, 23, 33, 2, 22, 173, 57922 }, // ‰
     { 40, 23, 42, 2, 22, 230, 58095 }, // ‱
@@ -4867,21 +4867,21 @@ static const EpdGlyph notosans_14_italicGlyphs[] = {
     { 4, 22, 8, 2, 21, 22, 61260 }, // ⁝
     { 5, 23, 8, 2, 22, 29, 61282 }, // ⁞
     { 0, 0, 6, 0, 0, 0, 61311 }, //  
-    { 0, 0, 18, 0, 0, 0, 61311 }, // ⁠
-    { 0, 0, 18, 0, 0, 0, 61311 }, // ⁡
-    { 0, 0, 18, 0, 0, 0, 61311 }, // ⁢
-    { 0, 0, 18, 0, 0, 0, 61311 }, // ⁣
-    { 0, 0, 18, 0, 0, 0, 61311 }, // ⁤
-    { 0, 0, 18, 0, 0, 0, 61311 }, // ⁦
-    { 0, 0, 18, 0, 0, 0, 61311 }, // ⁧
-    { 0, 0, 18, 0, 0, 0, 61311 }, // ⁨
-    { 0, 0, 18, 0, 0, 0, 61311 }, // ⁩
-    { 8, 25, 0, -4, 21, 50, 61311 }, // ⁪
-    { 8, 25, 0, -4, 21, 50, 61361 }, // ⁫
-    { 8, 25, 0, -4, 21, 50, 61411 }, // ⁬
-    { 8, 25, 0, -4, 21, 50, 61461 }, // ⁭
-    { 8, 25, 0, -4, 21, 50, 61511 }, // ⁮
-    { 8, 25, 0, -4, 21, 50, 61561 }, // ⁯
+    { 0, 0, 18, 0, 0, 0, 61311 }, // U+2060
+    { 0, 0, 18, 0, 0, 0, 61311 }, // U+2061
+    { 0, 0, 18, 0, 0, 0, 61311 }, // U+2062
+    { 0, 0, 18, 0, 0, 0, 61311 }, // U+2063
+    { 0, 0, 18, 0, 0, 0, 61311 }, // U+2064
+    { 0, 0, 18, 0, 0, 0, 61311 }, // U+2066
+    { 0, 0, 18, 0, 0, 0, 61311 }, // U+2067
+    { 0, 0, 18, 0, 0, 0, 61311 }, // U+2068
+    { 0, 0, 18, 0, 0, 0, 61311 }, // U+2069
+    { 8, 25, 0, -4, 21, 50, 61311 }, // U+206A
+    { 8, 25, 0, -4, 21, 50, 61361 }, // U+206B
+    { 8, 25, 0, -4, 21, 50, 61411 }, // U+206C
+    { 8, 25, 0, -4, 21, 50, 61461 }, // U+206D
+    { 8, 25, 0, -4, 21, 50, 61511 }, // U+206E
+    { 8, 25, 0, -4, 21, 50, 61561 }, // U+206F
     { 15, 22, 16, 2, 22, 83, 61611 }, // ₠
     { 17, 25, 16, 1, 23, 107, 61694 }, // ₡
     { 16, 23, 16, 1, 22, 92, 61801 }, // ₢
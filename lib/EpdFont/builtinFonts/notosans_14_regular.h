@@ -3837,8 +3837,8 @@ static const uint8_t notosans_14_regularBitmaps[61202] = {
 };
 
 static const EpdGlyph notosans_14_regularGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 8, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 8, 0, 0, 0, 0 }, //  
     { 4, 22, 8, 2, 21, 22, 0 }, // !
     { 9, 8, 12, 1, 21, 18, 22 }, // "
@@ -3947,7 +3947,7 @@ static const EpdGlyph notosans_14_regularGlyphs[] = {
     { 9, 11, 10, 0, 22, 25, 7065 }, // ª
     { 13, 13, 15, 1, 14, 43, 7090 }, // «
     { 15, 9, 17, 1, 12, 34, 7133 }, // ¬
-    { 8, 3, 9, 1, 9, 6, 7167 }, // ­
+    { 8, 3, 9, 1, 9, 6, 7167 }, // U+00AD
     { 22, 23, 24, 1, 22, 127, 7173 }, // ®
     { 16, 3, 15, -1, 25, 12, 7300 }, // ¯
     { 10, 10, 12, 1, 22, 25, 7312 }, // °
@@ -4537,11 +4537,11 @@ static const EpdGlyph notosans_14_regularGlyphs[] = {
     { 0, 0, 8, 0, 0, 0, 53326 }, //  
     { 0, 0, 5, 0, 0, 0, 53326 }, //  
     { 0, 0, 3, 0, 0, 0, 53326 }, //  
-    { 0, 0, 0, 0, 0, 0, 53326 }, // ​
-    { 0, 0, 0, 0, 0, 0, 53326 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 53326 }, // ‍
-    { 8, 25, 0, -1, 21, 50, 53326 }, // ‎
-    { 8, 25, 0, -7, 21, 50, 53376 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 53326 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 53326 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 53326 }, // U+200D
+    { 8, 25, 0, -1, 21, 50, 53326 }, // U+200E
+    { 8, 25, 0, -7, 21, 50, 53376 }, // U+200F
     { 8, 3, 9, 1, 9, 6, 53426 }, // ‐
     { 8, 3, 9, 1, 9, 6, 53432 }, // ‑
     { 15, 3, 17, 1, 12, 12, 53438 }, // ‒
@@ -4568,11 +4568,11 @@ static const EpdGlyph notosans_14_regularGlyphs[] = {
     { 4, 5, 8, 2, 10, 5, 53968 }, // ‧
     { 0, 0, 18, 0, 0, 0, 53973 }, //  
     { 0, 0, 18, 0, 0, 0, 53973 }, //  
-    { 8, 22, 0, -1, 18, 44, 53973 }, // ‪
-    { 8, 22, 0, -7, 18, 44, 54017 }, // ‫
-    { 8, 25, 0, -4, 21, 50, 54061 }, // ‬
-    { 8, 25, 0, -4, 21, 50, 54111 }, // ‭
-    { 8, 25, 0, -4, 21, 50, 54161 }, // ‮
+    { 8, 22, 0, -1, 18, 44, 53973 }, // U+202A
+    { 8, 22, 0, -7, 18, 44, 54017 }, // U+202B
+    { 8, 25, 0, -4, 21, 50, 54061 }, // U+202C
+    { 8, 25, 0, -4, 21, 50, 54111 }, // U+202D
+    { 8, 25, 0, -4, 21, 50, 54161 }, // U+202E
     { 0, 0, 5, 0, 0, 0, 54211 }, //  
     { 32, 23, 34, 1, 22, 184, 54211 }, // ‰
     { 43, 23, 45, 1, 22, 248, 54395 }, // ‱
@@ -4622,21 +4622,21 @@ static const EpdGlyph notosans_14_regularGlyphs[] = {
     { 4, 22, 8, 2, 21, 22, 57454 }, // ⁝
     { 4, 23, 8, 2, 22, 23, 57476 }, // ⁞
     { 0, 0, 6, 0, 0, 0, 57499 }, //  
-    { 0, 0, 18, 0, 0, 0, 57499 }, // ⁠
-    { 0, 0, 18, 0, 0, 0, 57499 }, // ⁡
-    { 0, 0, 18, 0, 0, 0, 57499 }, // ⁢
-    { 0, 0, 18, 0, 0, 0, 57499 }, // ⁣
-    { 0, 0, 18, 0, 0, 0, 57499 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 57499 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 57499 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 57499 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 57499 }, // ⁩
-    { 8, 25, 0, -4, 21, 50, 57499 }, // ⁪
-    { 8, 25, 0, -4, 21, 50, 57549 }, // ⁫
-    { 8, 25, 0, -4, 21, 50, 57599 }, // ⁬
-    { 8, 25, 0, -4, 21, 50, 57649 }, // ⁭
-    { 8, 25, 0, -4, 21, 50, 57699 }, // ⁮
-    { 8, 25, 0, -4, 21, 50, 57749 }, // ⁯
+    { 0, 0, 18, 0, 0, 0, 57499 }, // U+2060
+    { 0, 0, 18, 0, 0, 0, 57499 }, // U+2061
+    { 0, 0, 18, 0, 0, 0, 57499 }, // U+2062
+    { 0, 0, 18, 0, 0, 0, 57499 }, // U+2063
+    { 0, 0, 18, 0, 0, 0, 57499 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 57499 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 57499 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 57499 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 57499 }, // U+2069
+    { 8, 25, 0, -4, 21, 50, 57499 }, // U+206A
+    { 8, 25, 0, -4, 21, 50, 57549 }, // U+206B
+    { 8, 25, 0, -4, 21, 50, 57599 }, // U+206C
+    { 8, 25, 0, -4, 21, 50, 57649 }, // U+206D
+    { 8, 25, 0, -4, 21, 50, 57699 }, // U+206E
+    { 8, 25, 0, -4, 21, 50, 57749 }, // U+206F
     { 15, 22, 17, 1, 22, 83, 57799 }, // ₠
     { 16, 25, 17, 1, 23, 100, 57882 }, // ₡
     { 15, 23, 17, 1, 22, 87, 57982 }, // ₢
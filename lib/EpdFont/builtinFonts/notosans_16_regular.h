@@ -4916,8 +4916,8 @@ static const uint8_t notosans_16_regularBitmaps[78480] = {
 };
 
 static const EpdGlyph notosans_16_regularGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 9, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 9, 0, 0, 0, 0 }, //  
     { 5, 25, 9, 2, 24, 32, 0 }, // !
     { 10, 9, 14, 2, 24, 23, 32 }, // "
@@ -5026,7 +5026,7 @@ static const EpdGlyph notosans_16_regularGlyphs[] = {
     { 10, 13, 12, 1, 25, 33, 9050 }, // ª
     { 15, 15, 17, 1, 16, 57, 9083 }, // «
     { 17, 9, 19, 1, 13, 39, 9140 }, // ¬
-    { 9, 4, 11, 1, 11, 9, 9179 }, // ­
+    { 9, 4, 11, 1, 11, 9, 9179 }, // U+00AD
     { 26, 26, 28, 1, 25, 169, 9188 }, // ®
     { 18, 3, 17, -1, 28, 14, 9357 }, // ¯
     { 12, 12, 14, 1, 25, 36, 9371 }, // °
@@ -5616,11 +5616,11 @@ static const EpdGlyph notosans_16_regularGlyphs[] = {
     { 0, 0, 9, 0, 0, 0, 68456 }, //  
     { 0, 0, 6, 0, 0, 0, 68456 }, //  
     { 0, 0, 3, 0, 0, 0, 68456 }, //  
-    { 0, 0, 0, 0, 0, 0, 68456 }, // ​
-    { 0, 0, 0, 0, 0, 0, 68456 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 68456 }, // ‍
-    { 9, 28, 0, -1, 23, 63, 68456 }, // ‎
-    { 9, 28, 0, -8, 23, 63, 68519 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 68456 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 68456 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 68456 }, // U+200D
+    { 9, 28, 0, -1, 23, 63, 68456 }, // U+200E
+    { 9, 28, 0, -8, 23, 63, 68519 }, // U+200F
     { 9, 4, 11, 1, 11, 9, 68582 }, // ‐
     { 9, 4, 11, 1, 11, 9, 68591 }, // ‑
     { 17, 4, 19, 1, 14, 17, 68600 }, // ‒
@@ -5647,11 +5647,11 @@ static const EpdGlyph notosans_16_regularGlyphs[] = {
     { 5, 6, 9, 2, 11, 8, 69266 }, // ‧
     { 0, 0, 20, 0, 0, 0, 69274 }, //  
     { 0, 0, 20, 0, 0, 0, 69274 }, //  
-    { 9, 26, 0, -1, 21, 59, 69274 }, // ‪
-    { 9, 26, 0, -8, 21, 59, 69333 }, // ‫
-    { 8, 28, 0, -4, 23, 56, 69392 }, // ‬
-    { 8, 28, 0, -4, 23, 56, 69448 }, // ‭
-    { 8, 28, 0, -4, 23, 56, 69504 }, // ‮
+    { 9, 26, 0, -1, 21, 59, 69274 }, // U+202A
+    { 9, 26, 0, -8, 21, 59, 69333 }, // U+202B
+    { 8, 28, 0, -4, 23, 56, 69392 }, // U+202C
+    { 8, 28, 0, -4, 23, 56, 69448 }, // U+202D
+    { 8, 28, 0, -4, 23, 56, 69504 }, // U+202E
     { 0, 0, 6, 0, 0, 0, 69560 }, //  
     { 37, 26, 39, 1, 25, 241, 69560 }, // ‰
     { 49, 26, 51, 1, 25, 319, 69801 }, // ‱
@@ -5701,21 +5701,21 @@ static const EpdGlyph notosans_16_regularGlyphs[] = {
     { 5, 25, 9, 2, 24, 32, 73711 }, // ⁝
     { 5, 26, 9, 2, 25, 33, 73743 }, // ⁞
     { 0, 0, 7, 0, 0, 0, 73776 }, //  
-    { 0, 0, 20, 0, 0, 0, 73776 }, // ⁠
-    { 0, 0, 20, 0, 0, 0, 73776 }, // ⁡
-    { 0, 0, 20, 0, 0, 0, 73776 }, // ⁢
-    { 0, 0, 20, 0, 0, 0, 73776 }, // ⁣
-    { 0, 0, 20, 0, 0, 0, 73776 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 73776 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 73776 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 73776 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 73776 }, // ⁩
-    { 8, 28, 0, -4, 23, 56, 73776 }, // ⁪
-    { 8, 28, 0, -4, 23, 56, 73832 }, // ⁫
-    { 8, 28, 0, -4, 23, 56, 73888 }, // ⁬
-    { 8, 29, 0, -4, 24, 58, 73944 }, // ⁭
-    { 8, 28, 0, -4, 23, 56, 74002 }, // ⁮
-    { 8, 28, 0, -4, 23, 56, 74058 }, // ⁯
+    { 0, 0, 20, 0, 0, 0, 73776 }, // U+2060
+    { 0, 0, 20, 0, 0, 0, 73776 }, // U+2061
+    { 0, 0, 20, 0, 0, 0, 73776 }, // U+2062
+    { 0, 0, 20, 0, 0, 0, 73776 }, // U+2063
+    { 0, 0, 20, 0, 0, 0, 73776 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 73776 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 73776 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 73776 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 73776 }, // U+2069
+    { 8, 28, 0, -4, 23, 56, 73776 }, // U+206A
+    { 8, 28, 0, -4, 23, 56, 73832 }, // U+206B
+    { 8, 28, 0, -4, 23, 56, 73888 }, // U+206C
+    { 8, 29, 0, -4, 24, 58, 73944 }, // U+206D
+    { 8, 28, 0, -4, 23, 56, 74002 }, // U+206E
+    { 8, 28, 0, -4, 23, 56, 74058 }, // U+206F
     { 17, 25, 19, 1, 25, 107, 74114 }, // ₠
     { 18, 28, 19, 1, 26, 126, 74221 }, // ₡
     { 17, 26, 19, 1, 25, 111, 74347 }, // ₢
@@ -6769,8 +6769,8 @@ static const uint8_t notosans_18_boldBitmaps[108125] = {
 };
 
 static const EpdGlyph notosans_18_boldGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 10, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 10, 0, 0, 0, 0 }, //  
     { 7, 28, 11, 2, 27, 49, 0 }, // !
     { 14, 10, 18, 2, 27, 35, 49 }, // "
@@ -6879,7 +6879,7 @@ static const EpdGlyph notosans_18_boldGlyphs[] = {
     { 12, 15, 14, 1, 28, 45, 12279 }, // ª
     { 21, 18, 23, 1, 19, 95, 12324 }, // «
     { 19, 12, 21, 1, 16, 57, 12419 }, // ¬
-    { 10, 6, 12, 1, 13, 15, 12476 }, // ­
+    { 10, 6, 12, 1, 13, 15, 12476 }, // U+00AD
     { 29, 29, 31, 1, 28, 211, 12491 }, // ®
     { 20, 5, 19, -1, 33, 25, 12702 }, // ¯
     { 14, 14, 16, 1, 28, 49, 12727 }, // °
@@ -7469,11 +7469,11 @@ static const EpdGlyph notosans_18_boldGlyphs[] = {
     { 0, 0, 11, 0, 0, 0, 94496 }, //  
     { 0, 0, 6, 0, 0, 0, 94496 }, //  
     { 0, 0, 4, 0, 0, 0, 94496 }, //  
-    { 0, 0, 0, 0, 0, 0, 94496 }, // ​
-    { 0, 0, 0, 0, 0, 0, 94496 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 94496 }, // ‍
-    { 9, 31, 0, -1, 26, 70, 94496 }, // ‎
-    { 9, 31, 0, -8, 26, 70, 94566 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 94496 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 94496 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 94496 }, // U+200D
+    { 9, 31, 0, -1, 26, 70, 94496 }, // U+200E
+    { 9, 31, 0, -8, 26, 70, 94566 }, // U+200F
     { 10, 6, 12, 1, 13, 15, 94636 }, // ‐
     { 10, 6, 12, 1, 13, 15, 94651 }, // ‑
     { 20, 5, 22, 1, 16, 25, 94666 }, // ‒
@@ -7500,11 +7500,11 @@ static const EpdGlyph notosans_18_boldGlyphs[] = {
     { 7, 7, 11, 2, 13, 13, 95669 }, // ‧
     { 0, 0, 23, 0, 0, 0, 95682 }, //  
     { 0, 0, 23, 0, 0, 0, 95682 }, //  
-    { 9, 28, 0, -1, 23, 63, 95682 }, // ‪
-    { 9, 28, 0, -8, 23, 63, 95745 }, // ‫
-    { 10, 31, 0, -5, 26, 78, 95808 }, // ‬
-    { 10, 31, 0, -5, 26, 78, 95886 }, // ‭
-    { 10, 31, 0, -5, 26, 78, 95964 }, // ‮
+    { 9, 28, 0, -1, 23, 63, 95682 }, // U+202A
+    { 9, 28, 0, -8, 23, 63, 95745 }, // U+202B
+    { 10, 31, 0, -5, 26, 78, 95808 }, // U+202C
+    { 10, 31, 0, -5, 26, 78, 95886 }, // U+202D
+    { 10, 31, 0, -5, 26, 78, 95964 }, // U+202E
     { 0, 0, 6, 0, 0, 0, 96042 }, //  
     { 46, 29, 48, 1, 28, 334, 96042 }, // ‰
     { 61, 29, 63, 1, 28, 443, 96376 }, // ‱
@@ -7554,21 +7554,21 @@ static const EpdGlyph notosans_18_boldGlyphs[] = {
     { 7, 30, 11, 2, 29, 53, 101744 }, // ⁝
     { 7, 29, 11, 2, 28, 51, 101797 }, // ⁞
     { 0, 0, 8, 0, 0, 0, 101848 }, //  
-    { 0, 0, 23, 0, 0, 0, 101848 }, // ⁠
-    { 0, 0, 23, 0, 0, 0, 101848 }, // ⁡
-    { 0, 0, 23, 0, 0, 0, 101848 }, // ⁢
-    { 0, 0, 23, 0, 0, 0, 101848 }, // ⁣
-    { 0, 0, 23, 0, 0, 0, 101848 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 101848 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 101848 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 101848 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 101848 }, // ⁩
-    { 10, 31, 0, -5, 26, 78, 101848 }, // ⁪
-    { 10, 31, 0, -5, 26, 78, 101926 }, // ⁫
-    { 10, 31, 0, -5, 26, 78, 102004 }, // ⁬
-    { 10, 31, 0, -5, 26, 78, 102082 }, // ⁭
-    { 10, 31, 0, -5, 26, 78, 102160 }, // ⁮
-    { 10, 31, 0, -5, 26, 78, 102238 }, // ⁯
+    { 0, 0, 23, 0, 0, 0, 101848 }, // U+2060
+    { 0, 0, 23, 0, 0, 0, 101848 }, // U+2061
+    { 0, 0, 23, 0, 0, 0, 101848 }, // U+2062
+    { 0, 0, 23, 0, 0, 0, 101848 }, // U+2063
+    { 0, 0, 23, 0, 0, 0, 101848 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 101848 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 101848 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 101848 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 101848 }, // U+2069
+    { 10, 31, 0, -5, 26, 78, 101848 }, // U+206A
+    { 10, 31, 0, -5, 26, 78, 101926 }, // U+206B
+    { 10, 31, 0, -5, 26, 78, 102004 }, // U+206C
+    { 10, 31, 0, -5, 26, 78, 102082 }, // U+206D
+    { 10, 31, 0, -5, 26, 78, 102160 }, // U+206E
+    { 10, 31, 0, -5, 26, 78, 102238 }, // U+206F
     { 21, 28, 21, 0, 28, 147, 102316 }, // ₠
     { 22, 32, 23, 1, 29, 176, 102463 }, // ₡
     { 20, 29, 21, 1, 28, 145, 102639 }, // ₢
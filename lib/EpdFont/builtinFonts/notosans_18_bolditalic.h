@@ -7216,8 +7216,8 @@ static const uint8_t notosans_18_bolditalicBitmaps[115270] = {
 };
 
 static const EpdGlyph notosans_18_bolditalicGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 10, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 10, 0, 0, 0, 0 }, //  
     { 12, 28, 11, 0, 27, 84, 0 }, // !
     { 15, 10, 17, 3, 27, 38, 84 }, // "
@@ -7326,7 +7326,7 @@ static const EpdGlyph notosans_18_bolditalicGlyphs[] = {
     { 15, 15, 14, 2, 28, 57, 13565 }, // ª
     { 21, 18, 21, 1, 19, 95, 13622 }, // «
     { 20, 12, 21, 1, 16, 60, 13717 }, // ¬
-    { 12, 6, 12, 0, 13, 18, 13777 }, // ­
+    { 12, 6, 12, 0, 13, 18, 13777 }, // U+00AD
     { 29, 29, 31, 1, 28, 211, 13795 }, // ®
     { 18, 5, 16, 3, 33, 23, 14006 }, // ¯
     { 14, 14, 16, 1, 28, 49, 14029 }, // °
@@ -7916,11 +7916,11 @@ static const EpdGlyph notosans_18_bolditalicGlyphs[] = {
     { 0, 0, 11, 0, 0, 0, 101110 }, //  
     { 0, 0, 6, 0, 0, 0, 101110 }, //  
     { 0, 0, 4, 0, 0, 0, 101110 }, //  
-    { 0, 0, 0, 0, 0, 0, 101110 }, // ​
-    { 0, 0, 0, 0, 0, 0, 101110 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 101110 }, // ‍
-    { 9, 31, 0, -1, 26, 70, 101110 }, // ‎
-    { 9, 31, 0, -8, 26, 70, 101180 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 101110 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 101110 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 101110 }, // U+200D
+    { 9, 31, 0, -1, 26, 70, 101110 }, // U+200E
+    { 9, 31, 0, -8, 26, 70, 101180 }, // U+200F
     { 12, 6, 12, 0, 13, 18, 101250 }, // ‐
     { 12, 6, 12, 0, 13, 18, 101268 }, // ‑
     { 19, 6, 21, 1, 16, 29, 101286 }, // ‒
@@ -7947,11 +7947,11 @@ static const EpdGlyph notosans_18_bolditalicGlyphs[] = {
     { 8, 7, 12, 2, 13, 14, 102342 }, // ‧
     { 0, 0, 23, 0, 0, 0, 102356 }, //  
     { 0, 0, 23, 0, 0, 0, 102356 }, //  
-    { 9, 28, 0, -1, 23, 63, 102356 }, // ‪
-    { 9, 28, 0, -8, 23, 63, 102419 }, // ‫
-    { 10, 31, 0, -5, 26, 78, 102482 }, // ‬
-    { 10, 31, 0, -5, 26, 78, 102560 }, // ‭
-    { 10, 31, 0, -5, 26, 78, 102638 }, // ‮
+    { 9, 28, 0, -1, 23, 63, 102356 }, // U+202A
+    { 9, 28, 0, -8, 23, 63, 102419 }, // U+202B
+    { 10, 31, 0, -5, 26, 78, 102482 }, // U+202C
+    { 10, 31, 0, -5, 26, 78, 102560 }, // U+202D
+    { 10, 31, 0, -5, 26, 78, 102638 }, // U+202E
     { 0, 0, 6, 0, 0, 0, 102716 }, //  
     { 43, 29, 46, 2, 28, 312, 102716 }, // ‰
     { 56, 29, 59, 2, 28, 406, 103028 }, // ‱
@@ -8001,21 +8001,21 @@ static const EpdGlyph notosans_18_bolditalicGlyphs[] = {
     { 7, 30, 11, 2, 29, 53, 108652 }, // ⁝
     { 7, 29, 11, 2, 28, 51, 108705 }, // ⁞
     { 0, 0, 8, 0, 0, 0, 108756 }, //  
-    { 0, 0, 23, 0, 0, 0, 108756 }, // ⁠
-    { 0, 0, 23, 0, 0, 0, 108756 }, // ⁡
-    { 0, 0, 23, 0, 0, 0, 108756 }, // ⁢
-    { 0, 0, 23, 0, 0, 0, 108756 }, // ⁣
-    { 0, 0, 23, 0, 0, 0, 108756 }, // ⁤
-    { 0, 0, 23, 0, 0, 0, 108756 }, // ⁦
-    { 0, 0, 23, 0, 0, 0, 108756 }, // ⁧
-    { 0, 0, 23, 0, 0, 0, 108756 }, // ⁨
-    { 0, 0, 23, 0, 0, 0, 108756 }, // ⁩
-    { 10, 31, 0, -5, 26, 78, 108756 }, // ⁪
-    { 10, 31, 0, -5, 26, 78, 108834 }, // ⁫
-    { 10, 31, 0, -5, 26, 78, 108912 }, // ⁬
-    { 10, 31, 0, -5, 26, 78, 108990 }, // ⁭
-    { 10, 31, 0, -5, 26, 78, 109068 }, // ⁮
-    { 10, 31, 0, -5, 26, 78, 109146 }, // ⁯
+    { 0, 0, 23, 0, 0, 0, 108756 }, // U+2060
+    { 0, 0, 23, 0, 0, 0, 108756 }, // U+2061
+    { 0, 0, 23, 0, 0, 0, 108756 }, // U+2062
+    { 0, 0, 23, 0, 0, 0, 108756 }, // U+2063
+    { 0, 0, 23, 0, 0, 0, 108756 }, // U+2064
+    { 0, 0, 23, 0, 0, 0, 108756 }, // U+2066
+    { 0, 0, 23, 0, 0, 0, 108756 }, // U+2067
+    { 0, 0, 23, 0, 0, 0, 108756 }, // U+2068
+    { 0, 0, 23, 0, 0, 0, 108756 }, // U+2069
+    { 10, 31, 0, -5, 26, 78, 108756 }, // U+206A
+    { 10, 31, 0, -5, 26, 78, 108834 }, // U+206B
+    { 10, 31, 0, -5, 26, 78, 108912 }, // U+206C
+    { 10, 31, 0, -5, 26, 78, 108990 }, // U+206D
+    { 10, 31, 0, -5, 26, 78, 109068 }, // U+206E
+    { 10, 31, 0, -5, 26, 78, 109146 }, // U+206F
     { 21, 28, 21, 2, 28, 147, 109224 }, // ₠
     { 23, 32, 21, 1, 29, 184, 109371 }, // ₡
     { 23, 29, 21, 1, 28, 167, 109555 }, // ₢
@@ -696,8 +696,8 @@ static const uint8_t notosans_8_regularBitmaps[10949] = {
 };
 
 static const EpdGlyph notosans_8_regularGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 4, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 4, 0, 0, 0, 0 }, //  
     { 3, 13, 4, 1, 12, 5, 0 }, // !
     { 5, 5, 7, 1, 12, 4, 5 }, // "
@@ -806,7 +806,7 @@ static const EpdGlyph notosans_8_regularGlyphs[] = {
     { 6, 7, 6, 0, 13, 6, 1287 }, // ª
     { 8, 8, 8, 0, 8, 8, 1293 }, // «
     { 9, 5, 10, 0, 7, 6, 1301 }, // ¬
-    { 5, 3, 5, 0, 6, 2, 1307 }, // ­
+    { 5, 3, 5, 0, 6, 2, 1307 }, // U+00AD
     { 14, 14, 14, 0, 13, 25, 1309 }, // ®
     { 10, 2, 8, -1, 14, 3, 1334 }, // ¯
     { 7, 7, 7, 0, 13, 7, 1337 }, // °
@@ -1396,11 +1396,11 @@ static const EpdGlyph notosans_8_regularGlyphs[] = {
     { 0, 0, 4, 0, 0, 0, 9523 }, //  
     { 0, 0, 3, 0, 0, 0, 9523 }, //  
     { 0, 0, 2, 0, 0, 0, 9523 }, //  
-    { 0, 0, 0, 0, 0, 0, 9523 }, // ​
-    { 0, 0, 0, 0, 0, 0, 9523 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 9523 }, // ‍
-    { 5, 15, 0, -1, 12, 10, 9523 }, // ‎
-    { 5, 15, 0, -4, 12, 10, 9533 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 9523 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 9523 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 9523 }, // U+200D
+    { 5, 15, 0, -1, 12, 10, 9523 }, // U+200E
+    { 5, 15, 0, -4, 12, 10, 9533 }, // U+200F
     { 5, 3, 5, 0, 6, 2, 9543 }, // ‐
     { 5, 3, 5, 0, 6, 2, 9545 }, // ‑
     { 9, 2, 10, 0, 7, 3, 9547 }, // ‒
@@ -1427,11 +1427,11 @@ static const EpdGlyph notosans_8_regularGlyphs[] = {
     { 3, 4, 4, 1, 6, 2, 9652 }, // ‧
     { 0, 0, 10, 0, 0, 0, 9654 }, //  
     { 0, 0, 10, 0, 0, 0, 9654 }, //  
-    { 5, 14, 0, -1, 11, 9, 9654 }, // ‪
-    { 5, 14, 0, -4, 11, 9, 9663 }, // ‫
-    { 4, 15, 0, -2, 12, 8, 9672 }, // ‬
-    { 4, 15, 0, -2, 12, 8, 9680 }, // ‭
-    { 4, 15, 0, -2, 12, 8, 9688 }, // ‮
+    { 5, 14, 0, -1, 11, 9, 9654 }, // U+202A
+    { 5, 14, 0, -4, 11, 9, 9663 }, // U+202B
+    { 4, 15, 0, -2, 12, 8, 9672 }, // U+202C
+    { 4, 15, 0, -2, 12, 8, 9680 }, // U+202D
+    { 4, 15, 0, -2, 12, 8, 9688 }, // U+202E
     { 0, 0, 3, 0, 0, 0, 9696 }, //  
     { 19, 14, 20, 0, 13, 34, 9696 }, // ‰
     { 25, 14, 26, 0, 13, 44, 9730 }, // ‱
@@ -1481,21 +1481,21 @@ static const EpdGlyph notosans_8_regularGlyphs[] = {
     { 3, 13, 4, 1, 12, 5, 10297 }, // ⁝
     { 3, 14, 4, 1, 13, 6, 10302 }, // ⁞
     { 0, 0, 4, 0, 0, 0, 10308 }, //  
-    { 0, 0, 10, 0, 0, 0, 10308 }, // ⁠
-    { 0, 0, 10, 0, 0, 0, 10308 }, // ⁡
-    { 0, 0, 10, 0, 0, 0, 10308 }, // ⁢
-    { 0, 0, 10, 0, 0, 0, 10308 }, // ⁣
-    { 0, 0, 10, 0, 0, 0, 10308 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 10308 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 10308 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 10308 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 10308 }, // ⁩
-    { 4, 15, 0, -2, 12, 8, 10308 }, // ⁪
-    { 4, 15, 0, -2, 12, 8, 10316 }, // ⁫
-    { 4, 15, 0, -2, 12, 8, 10324 }, // ⁬
-    { 4, 15, 0, -2, 12, 8, 10332 }, // ⁭
-    { 4, 15, 0, -2, 12, 8, 10340 }, // ⁮
-    { 4, 15, 0, -2, 12, 8, 10348 }, // ⁯
+    { 0, 0, 10, 0, 0, 0, 10308 }, // U+2060
+    { 0, 0, 10, 0, 0, 0, 10308 }, // U+2061
+    { 0, 0, 10, 0, 0, 0, 10308 }, // U+2062
+    { 0, 0, 10, 0, 0, 0, 10308 }, // U+2063
+    { 0, 0, 10, 0, 0, 0, 10308 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 10308 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 10308 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 10308 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 10308 }, // U+2069
+    { 4, 15, 0, -2, 12, 8, 10308 }, // U+206A
+    { 4, 15, 0, -2, 12, 8, 10316 }, // U+206B
+    { 4, 15, 0, -2, 12, 8, 10324 }, // U+206C
+    { 4, 15, 0, -2, 12, 8, 10332 }, // U+206D
+    { 4, 15, 0, -2, 12, 8, 10340 }, // U+206E
+    { 4, 15, 0, -2, 12, 8, 10348 }, // U+206F
     { 9, 13, 10, 0, 13, 15, 10356 }, // ₠
     { 10, 14, 10, 0, 13, 18, 10371 }, // ₡
     { 9, 14, 10, 0, 13, 16, 10389 }, // ₢
@@ -3366,7 +3366,7 @@ static const EpdGlyph opendyslexic_10_bolditalicGlyphs[] = {
     { 8, 7, 14, 6, 16, 14, 6921 }, // ª
     { 15, 12, 17, 2, 12, 45, 6935 }, // «
     { 12, 8, 13, 2, 8, 24, 6980 }, // ¬
-    { 12, 3, 13, 2, 8, 9, 7004 }, // ­
+    { 12, 3, 13, 2, 8, 9, 7004 }, // U+00AD
     { 11, 9, 14, 6, 23, 25, 7013 }, // ®
     { 10, 4, 11, 4, 16, 10, 7038 }, // ¯
     { 12, 10, 14, 4, 16, 30, 7048 }, // °
@@ -3860,11 +3860,11 @@ static const EpdGlyph opendyslexic_10_bolditalicGlyphs[] = {
     { 0, 0, 5, 0, 0, 0, 45689 }, //  
     { 0, 0, 8, 0, 0, 0, 45689 }, //  
     { 0, 0, 6, 0, 0, 0, 45689 }, //  
-    { 0, 0, 3, 0, 0, 0, 45689 }, // ​
-    { 0, 0, 0, 0, 0, 0, 45689 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 45689 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 45689 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 45689 }, // ‏
+    { 0, 0, 3, 0, 0, 0, 45689 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 45689 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 45689 }, // U+200D
+    { 0, 0, 0, 0, 0, 0, 45689 }, // U+200E
+    { 0, 0, 0, 0, 0, 0, 45689 }, // U+200F
     { 12, 3, 11, 1, 8, 9, 45689 }, // ‐
     { 12, 3, 11, 1, 8, 9, 45698 }, // ‑
     { 18, 3, 11, -1, 8, 14, 45707 }, // ‒
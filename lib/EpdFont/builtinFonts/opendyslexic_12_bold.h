@@ -3957,7 +3957,7 @@ static const EpdGlyph opendyslexic_12_boldGlyphs[] = {
     { 9, 9, 16, 5, 19, 21, 8026 }, // ª
     { 14, 14, 13, 0, 13, 49, 8047 }, // «
     { 13, 9, 15, 1, 10, 30, 8096 }, // ¬
-    { 13, 3, 15, 1, 9, 10, 8126 }, // ­
+    { 13, 3, 15, 1, 9, 10, 8126 }, // U+00AD
     { 12, 12, 17, 2, 28, 36, 8136 }, // ®
     { 11, 4, 13, 1, 19, 11, 8172 }, // ¯
     { 12, 11, 17, 2, 19, 33, 8183 }, // °
@@ -4451,11 +4451,11 @@ static const EpdGlyph opendyslexic_12_boldGlyphs[] = {
     { 0, 0, 7, 0, 0, 0, 53744 }, //  
     { 0, 0, 9, 0, 0, 0, 53744 }, //  
     { 0, 0, 8, 0, 0, 0, 53744 }, //  
-    { 0, 0, 4, 0, 0, 0, 53744 }, // ​
-    { 0, 0, 0, 0, 0, 0, 53744 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 53744 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 53744 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 53744 }, // ‏
+    { 0, 0, 4, 0, 0, 0, 53744 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 53744 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 53744 }, // U+200D
+    { 0, 0, 0, 0, 0, 0, 53744 }, // U+200E
+    { 0, 0, 0, 0, 0, 0, 53744 }, // U+200F
     { 14, 3, 14, 0, 9, 11, 53744 }, // ‐
     { 14, 3, 14, 0, 9, 11, 53755 }, // ‑
     { 20, 3, 14, -3, 9, 15, 53766 }, // ‒
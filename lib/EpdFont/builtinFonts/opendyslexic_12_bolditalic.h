@@ -4765,7 +4765,7 @@ static const EpdGlyph opendyslexic_12_bolditalicGlyphs[] = {
     { 10, 9, 16, 7, 19, 23, 9891 }, // ª
     { 18, 14, 21, 2, 13, 63, 9914 }, // «
     { 14, 9, 15, 2, 10, 32, 9977 }, // ¬
-    { 15, 3, 15, 2, 9, 12, 10009 }, // ­
+    { 15, 3, 15, 2, 9, 12, 10009 }, // U+00AD
     { 13, 12, 17, 8, 28, 39, 10021 }, // ®
     { 11, 4, 13, 5, 19, 11, 10060 }, // ¯
     { 14, 11, 17, 5, 19, 39, 10071 }, // °
@@ -5259,11 +5259,11 @@ static const EpdGlyph opendyslexic_12_bolditalicGlyphs[] = {
     { 0, 0, 7, 0, 0, 0, 65513 }, //  
     { 0, 0, 9, 0, 0, 0, 65513 }, //  
     { 0, 0, 8, 0, 0, 0, 65513 }, //  
-    { 0, 0, 4, 0, 0, 0, 65513 }, // ​
-    { 0, 0, 0, 0, 0, 0, 65513 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 65513 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 65513 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 65513 }, // ‏
+    { 0, 0, 4, 0, 0, 0, 65513 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 65513 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 65513 }, // U+200D
+    { 0, 0, 0, 0, 0, 0, 65513 }, // U+200E
+    { 0, 0, 0, 0, 0, 0, 65513 }, // U+200F
     { 14, 3, 14, 2, 9, 11, 65513 }, // ‐
     { 14, 3, 14, 2, 9, 11, 65524 }, // ‑
     { 21, 3, 14, -1, 9, 16, 65535 }, // ‒
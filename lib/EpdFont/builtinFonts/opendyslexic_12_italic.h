@@ -4046,7 +4046,7 @@ static const EpdGlyph opendyslexic_12_italicGlyphs[] = {
     { 9, 9, 10, 4, 19, 21, 8604 }, // ª
     { 17, 12, 20, 2, 12, 51, 8625 }, // «
     { 13, 8, 15, 3, 9, 26, 8676 }, // ¬
-    { 13, 3, 14, 3, 9, 10, 8702 }, // ­
+    { 13, 3, 14, 3, 9, 10, 8702 }, // U+00AD
     { 11, 10, 13, 7, 27, 28, 8712 }, // ®
     { 10, 3, 13, 6, 18, 8, 8740 }, // ¯
     { 13, 12, 13, 4, 20, 39, 8748 }, // °
@@ -4540,11 +4540,11 @@ static const EpdGlyph opendyslexic_12_italicGlyphs[] = {
     { 0, 0, 7, 0, 0, 0, 55475 }, //  
     { 0, 0, 13, 0, 0, 0, 55475 }, //  
     { 0, 0, 12, 0, 0, 0, 55475 }, //  
-    { 0, 0, 8, 0, 0, 0, 55475 }, // ​
-    { 0, 0, 0, 0, 0, 0, 55475 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 55475 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 55475 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 55475 }, // ‏
+    { 0, 0, 8, 0, 0, 0, 55475 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 55475 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 55475 }, // U+200D
+    { 0, 0, 0, 0, 0, 0, 55475 }, // U+200E
+    { 0, 0, 0, 0, 0, 0, 55475 }, // U+200F
     { 13, 3, 14, 3, 9, 10, 55475 }, // ‐
     { 13, 3, 14, 3, 9, 10, 55485 }, // ‑
     { 19, 3, 19, 4, 9, 15, 55495 }, // ‒
@@ -3451,7 +3451,7 @@ static const EpdGlyph opendyslexic_12_regularGlyphs[] = {
     { 8, 9, 10, 2, 19, 18, 7083 }, // ª
     { 13, 12, 16, 1, 12, 39, 7101 }, // «
     { 13, 8, 15, 1, 9, 26, 7140 }, // ¬
-    { 13, 3, 14, 1, 9, 10, 7166 }, // ­
+    { 13, 3, 14, 1, 9, 10, 7166 }, // U+00AD
     { 11, 10, 13, 1, 27, 28, 7176 }, // ®
     { 10, 3, 13, 1, 18, 8, 7204 }, // ¯
     { 12, 12, 13, 1, 20, 36, 7212 }, // °
@@ -3945,11 +3945,11 @@ static const EpdGlyph opendyslexic_12_regularGlyphs[] = {
     { 0, 0, 7, 0, 0, 0, 46949 }, //  
     { 0, 0, 13, 0, 0, 0, 46949 }, //  
     { 0, 0, 12, 0, 0, 0, 46949 }, //  
-    { 0, 0, 8, 0, 0, 0, 46949 }, // ​
-    { 0, 0, 0, 0, 0, 0, 46949 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 46949 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 46949 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 46949 }, // ‏
+    { 0, 0, 8, 0, 0, 0, 46949 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 46949 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 46949 }, // U+200D
+    { 0, 0, 0, 0, 0, 0, 46949 }, // U+200E
+    { 0, 0, 0, 0, 0, 0, 46949 }, // U+200F
     { 13, 3, 14, 1, 9, 10, 46949 }, // ‐
     { 13, 3, 14, 1, 9, 10, 46959 }, // ‑
     { 18, 3, 19, 1, 9, 14, 46969 }, // ‒
@@ -6340,7 +6340,7 @@ static const EpdGlyph opendyslexic_14_bolditalicGlyphs[] = {
     { 10, 10, 19, 9, 22, 25, 13186 }, // ª
     { 20, 16, 24, 3, 15, 80, 13211 }, // «
     { 16, 11, 18, 3, 11, 44, 13291 }, // ¬
-    { 16, 4, 18, 3, 11, 16, 13335 }, // ­
+    { 16, 4, 18, 3, 11, 16, 13335 }, // U+00AD
     { 15, 13, 20, 9, 32, 49, 13351 }, // ®
     { 13, 5, 15, 6, 22, 17, 13400 }, // ¯
     { 16, 13, 20, 6, 22, 52, 13417 }, // °
@@ -6834,11 +6834,11 @@ static const EpdGlyph opendyslexic_14_bolditalicGlyphs[] = {
     { 0, 0, 8, 0, 0, 0, 87656 }, //  
     { 0, 0, 11, 0, 0, 0, 87656 }, //  
     { 0, 0, 9, 0, 0, 0, 87656 }, //  
-    { 0, 0, 5, 0, 0, 0, 87656 }, // ​
-    { 0, 0, 0, 0, 0, 0, 87656 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 87656 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 87656 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 87656 }, // ‏
+    { 0, 0, 5, 0, 0, 0, 87656 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 87656 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 87656 }, // U+200D
+    { 0, 0, 0, 0, 0, 0, 87656 }, // U+200E
+    { 0, 0, 0, 0, 0, 0, 87656 }, // U+200F
     { 17, 4, 16, 2, 11, 17, 87656 }, // ‐
     { 17, 4, 16, 2, 11, 17, 87673 }, // ‑
     { 25, 4, 16, -1, 11, 25, 87690 }, // ‒
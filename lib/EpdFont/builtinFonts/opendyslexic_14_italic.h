@@ -5397,7 +5397,7 @@ static const EpdGlyph opendyslexic_14_italicGlyphs[] = {
     { 10, 10, 12, 5, 22, 25, 11528 }, // ª
     { 19, 14, 24, 3, 14, 67, 11553 }, // «
     { 14, 9, 18, 4, 10, 32, 11620 }, // ¬
-    { 14, 3, 16, 4, 10, 11, 11652 }, // ­
+    { 14, 3, 16, 4, 10, 11, 11652 }, // U+00AD
     { 13, 11, 16, 8, 31, 36, 11663 }, // ®
     { 11, 3, 15, 7, 21, 9, 11699 }, // ¯
     { 15, 14, 16, 5, 23, 53, 11708 }, // °
@@ -5891,11 +5891,11 @@ static const EpdGlyph opendyslexic_14_italicGlyphs[] = {
     { 0, 0, 8, 0, 0, 0, 74518 }, //  
     { 0, 0, 15, 0, 0, 0, 74518 }, //  
     { 0, 0, 14, 0, 0, 0, 74518 }, //  
-    { 0, 0, 9, 0, 0, 0, 74518 }, // ​
-    { 0, 0, 0, 0, 0, 0, 74518 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 74518 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 74518 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 74518 }, // ‏
+    { 0, 0, 9, 0, 0, 0, 74518 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 74518 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 74518 }, // U+200D
+    { 0, 0, 0, 0, 0, 0, 74518 }, // U+200E
+    { 0, 0, 0, 0, 0, 0, 74518 }, // U+200F
     { 14, 3, 16, 4, 10, 11, 74518 }, // ‐
     { 14, 3, 16, 4, 10, 11, 74529 }, // ‑
     { 21, 3, 22, 5, 10, 16, 74540 }, // ‒
@@ -1882,7 +1882,7 @@ static const EpdGlyph opendyslexic_8_boldGlyphs[] = {
     { 6, 6, 11, 3, 13, 9, 3698 }, // ª
     { 9, 10, 9, 0, 10, 23, 3707 }, // «
     { 10, 6, 10, 0, 6, 15, 3730 }, // ¬
-    { 10, 2, 10, 0, 6, 5, 3745 }, // ­
+    { 10, 2, 10, 0, 6, 5, 3745 }, // U+00AD
     { 8, 7, 11, 2, 18, 14, 3750 }, // ®
     { 8, 3, 9, 0, 13, 6, 3764 }, // ¯
     { 8, 8, 11, 2, 13, 16, 3770 }, // °
@@ -2376,11 +2376,11 @@ static const EpdGlyph opendyslexic_8_boldGlyphs[] = {
     { 0, 0, 4, 0, 0, 0, 24659 }, //  
     { 0, 0, 6, 0, 0, 0, 24659 }, //  
     { 0, 0, 5, 0, 0, 0, 24659 }, //  
-    { 0, 0, 3, 0, 0, 0, 24659 }, // ​
-    { 0, 0, 0, 0, 0, 0, 24659 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 24659 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 24659 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 24659 }, // ‏
+    { 0, 0, 3, 0, 0, 0, 24659 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 24659 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 24659 }, // U+200D
+    { 0, 0, 0, 0, 0, 0, 24659 }, // U+200E
+    { 0, 0, 0, 0, 0, 0, 24659 }, // U+200F
     { 9, 2, 9, 0, 6, 5, 24659 }, // ‐
     { 9, 2, 9, 0, 6, 5, 24664 }, // ‑
     { 13, 2, 9, -2, 6, 7, 24669 }, // ‒
@@ -2210,7 +2210,7 @@ static const EpdGlyph opendyslexic_8_bolditalicGlyphs[] = {
     { 6, 6, 11, 5, 13, 9, 4473 }, // ª
     { 12, 10, 14, 1, 10, 30, 4482 }, // «
     { 10, 6, 10, 1, 6, 15, 4512 }, // ¬
-    { 10, 2, 10, 1, 6, 5, 4527 }, // ­
+    { 10, 2, 10, 1, 6, 5, 4527 }, // U+00AD
     { 9, 7, 11, 5, 18, 16, 4532 }, // ®
     { 8, 3, 9, 3, 13, 6, 4548 }, // ¯
     { 10, 8, 11, 3, 13, 20, 4554 }, // °
@@ -2704,11 +2704,11 @@ static const EpdGlyph opendyslexic_8_bolditalicGlyphs[] = {
     { 0, 0, 4, 0, 0, 0, 29390 }, //  
     { 0, 0, 6, 0, 0, 0, 29390 }, //  
     { 0, 0, 5, 0, 0, 0, 29390 }, //  
-    { 0, 0, 3, 0, 0, 0, 29390 }, // ​
-    { 0, 0, 0, 0, 0, 0, 29390 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 29390 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 29390 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 29390 }, // ‏
+    { 0, 0, 3, 0, 0, 0, 29390 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 29390 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 29390 }, // U+200D
+    { 0, 0, 0, 0, 0, 0, 29390 }, // U+200E
+    { 0, 0, 0, 0, 0, 0, 29390 }, // U+200F
     { 10, 2, 9, 1, 6, 5, 29390 }, // ‐
     { 10, 2, 9, 1, 6, 5, 29395 }, // ‑
     { 15, 2, 9, -1, 6, 8, 29400 }, // ‒
@@ -1979,7 +1979,7 @@ static const EpdGlyph opendyslexic_8_italicGlyphs[] = {
     { 7, 6, 7, 2, 13, 11, 4109 }, // ª
     { 12, 8, 14, 1, 8, 24, 4120 }, // «
     { 9, 5, 10, 2, 6, 12, 4144 }, // ¬
-    { 9, 2, 9, 2, 6, 5, 4156 }, // ­
+    { 9, 2, 9, 2, 6, 5, 4156 }, // U+00AD
     { 8, 7, 9, 4, 18, 14, 4161 }, // ®
     { 7, 3, 9, 4, 13, 6, 4175 }, // ¯
     { 9, 8, 9, 2, 14, 18, 4181 }, // °
@@ -2473,11 +2473,11 @@ static const EpdGlyph opendyslexic_8_italicGlyphs[] = {
     { 0, 0, 4, 0, 0, 0, 26282 }, //  
     { 0, 0, 9, 0, 0, 0, 26282 }, //  
     { 0, 0, 8, 0, 0, 0, 26282 }, //  
-    { 0, 0, 5, 0, 0, 0, 26282 }, // ​
-    { 0, 0, 0, 0, 0, 0, 26282 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 26282 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 26282 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 26282 }, // ‏
+    { 0, 0, 5, 0, 0, 0, 26282 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 26282 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 26282 }, // U+200D
+    { 0, 0, 0, 0, 0, 0, 26282 }, // U+200E
+    { 0, 0, 0, 0, 0, 0, 26282 }, // U+200F
     { 9, 2, 9, 2, 6, 5, 26282 }, // ‐
     { 9, 2, 9, 2, 6, 5, 26287 }, // ‑
     { 13, 2, 12, 2, 6, 7, 26292 }, // ‒
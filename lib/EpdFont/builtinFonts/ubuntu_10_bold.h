@@ -869,11 +869,11 @@ static const uint8_t ubuntu_10_boldBitmaps[13720] = {
 };
 
 static const EpdGlyph ubuntu_10_boldGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 5, 0, 0, 0, 0 }, // 	
-    { 0, 0, 5, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 5, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 5, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 5, 0, 0, 0, 0 }, //  
     { 4, 15, 6, 1, 15, 8, 0 }, // !
     { 8, 6, 10, 1, 16, 6, 8 }, // "
@@ -982,7 +982,7 @@ static const EpdGlyph ubuntu_10_boldGlyphs[] = {
     { 8, 8, 8, 0, 15, 8, 1986 }, // ª
     { 12, 11, 13, 0, 11, 17, 1994 }, // «
     { 10, 8, 12, 1, 9, 10, 2011 }, // ¬
-    { 7, 3, 7, 0, 8, 3, 2021 }, // ­
+    { 7, 3, 7, 0, 8, 3, 2021 }, // U+00AD
     { 15, 15, 17, 1, 15, 29, 2024 }, // ®
     { 8, 2, 8, 0, 15, 2, 2053 }, // ¯
     { 8, 6, 8, 0, 16, 6, 2055 }, // °
@@ -4,6 +4,7 @@ import zlib
 import sys
 import re
 import math
+import unicodedata
 import argparse
 from collections import namedtuple
 
@@ -273,9 +274,17 @@ for c in chunks(glyph_data, 16):
     print ("    " + " ".join(f"0x{b:02X}," for b in c))
 print ("};\n");
 
+def glyph_comment(code_point):
+    if code_point == 92:
+        return '<backslash>'
+    # Control and format characters (bidi overrides, zero width spaces) are invisible and trip -Wbidi-chars
+    if unicodedata.category(chr(code_point)) in ('Cc', 'Cf'):
+        return f'U+{code_point:04X}'
+    return chr(code_point)
+
 print(f"static const EpdGlyph {font_name}Glyphs[] = {{")
 for i, g in enumerate(glyph_props):
-    print ("    { " + ", ".join([f"{a}" for a in list(g[:-1])]),"},", f"// {chr(g.code_point) if g.code_point != 92 else '<backslash>'}")
+    print ("    { " + ", ".join([f"{a}" for a in list(g[:-1])]),"},", f"// {glyph_comment(g.code_point)}")
 print ("};\n");
 
 print(f"static const EpdUnicodeInterval {font_name}Intervals[] = {{")
@@ -11,6 +11,13 @@
 #include "Epub/parsers/TocNavParser.h"
 #include "Epub/parsers/TocNcxParser.h"
 
+namespace {
+bool isJpegHref(const std::string& itemHref) {
+  return (itemHref.size() > 4 && itemHref.substr(itemHref.length() - 4) == ".jpg") ||
+         (itemHref.size() > 5 && itemHref.substr(itemHref.length() - 5) == ".jpeg");
+}
+}  // namespace
+
 bool Epub::findContentOpfFile(std::string* contentOpfFile) const {
   const auto containerPath = "META-INF/container.xml";
   size_t containerSize;
@@ -98,50 +105,25 @@ bool Epub::parseTocNcxFile() const {
 
   Serial.printf("[%lu] [EBP] Parsing toc ncx file: %s\n", millis(), tocNcxItem.c_str());
 
-  const auto tmpNcxPath = getCachePath() + "/toc.ncx";
-  FsFile tempNcxFile;
-  if (!SdMan.openFileForWrite("EBP", tmpNcxPath, tempNcxFile)) {
-    return false;
-  }
-  readItemContentsToStream(tocNcxItem, tempNcxFile, 1024);
-  tempNcxFile.close();
-  if (!SdMan.openFileForRead("EBP", tmpNcxPath, tempNcxFile)) {
+  // Stream straight out of the zip, the parser only needs the size up front
+  size_t ncxSize;
+  if (!getItemSize(tocNcxItem, &ncxSize)) {
+    Serial.printf("[%lu] [EBP] Could not get size of toc ncx\n", millis());
     return false;
   }
-  const auto ncxSize = tempNcxFile.size();
 
   TocNcxParser ncxParser(contentBasePath, ncxSize, bookMetadataCache.get());
 
   if (!ncxParser.setup()) {
     Serial.printf("[%lu] [EBP] Could not setup toc ncx parser\n", millis());
-    tempNcxFile.close();
     return false;
   }
 
-  const auto ncxBuffer = static_cast<uint8_t*>(malloc(1024));
-  if (!ncxBuffer) {
-    Serial.printf("[%lu] [EBP] Could not allocate memory for toc ncx parser\n", millis());
-    tempNcxFile.close();
+  if (!readItemContentsToStream(tocNcxItem, ncxParser, 1024)) {
+    Serial.printf("[%lu] [EBP] Could not process all toc ncx data\n", millis());
     return false;
   }
 
-  while (tempNcxFile.available()) {
-    const auto readSize = tempNcxFile.read(ncxBuffer, 1024);
-    if (readSize == 0) break;
-    const auto processedSize = ncxParser.write(ncxBuffer, readSize);
-
-    if (processedSize != readSize) {
-      Serial.printf("[%lu] [EBP] Could not process all toc ncx data\n", millis());
-      free(ncxBuffer);
-      tempNcxFile.close();
-      return false;
-    }
-  }
-
-  free(ncxBuffer);
-  tempNcxFile.close();
-  SdMan.remove(tmpNcxPath.c_str());
-
   Serial.printf("[%lu] [EBP] Parsed TOC items\n", millis());
   return true;
 }
@@ -155,17 +137,12 @@ bool Epub::parseTocNavFile() const {
 
   Serial.printf("[%lu] [EBP] Parsing toc nav file: %s\n", millis(), tocNavItem.c_str());
 
-  const auto tmpNavPath = getCachePath() + "/toc.nav";
-  FsFile tempNavFile;
-  if (!SdMan.openFileForWrite("EBP", tmpNavPath, tempNavFile)) {
-    return false;
-  }
-  readItemContentsToStream(tocNavItem, tempNavFile, 1024);
-  tempNavFile.close();
-  if (!SdMan.openFileForRead("EBP", tmpNavPath, tempNavFile)) {
+  // Stream straight out of the zip, the parser only needs the size up front
+  size_t navSize;
+  if (!getItemSize(tocNavItem, &navSize)) {
+    Serial.printf("[%lu] [EBP] Could not get size of toc nav\n", millis());
     return false;
   }
-  const auto navSize = tempNavFile.size();
 
   TocNavParser navParser(contentBasePath, navSize, bookMetadataCache.get());
 
@@ -174,28 +151,11 @@ bool Epub::parseTocNavFile() const {
     return false;
   }
 
-  const auto navBuffer = static_cast<uint8_t*>(malloc(1024));
-  if (!navBuffer) {
-    Serial.printf("[%lu] [EBP] Could not allocate memory for toc nav parser\n", millis());
+  if (!readItemContentsToStream(tocNavItem, navParser, 1024)) {
+    Serial.printf("[%lu] [EBP] Could not process all toc nav data\n", millis());
     return false;
   }
 
-  while (tempNavFile.available()) {
-    const auto readSize = tempNavFile.read(navBuffer, 1024);
-    const auto processedSize = navParser.write(navBuffer, readSize);
-
-    if (processedSize != readSize) {
-      Serial.printf("[%lu] [EBP] Could not process all toc nav data\n", millis());
-      free(navBuffer);
-      tempNavFile.close();
-      return false;
-    }
-  }
-
-  free(navBuffer);
-  tempNavFile.close();
-  SdMan.remove(tmpNavPath.c_str());
-
   Serial.printf("[%lu] [EBP] Parsed TOC nav items\n", millis());
   return true;
 }
@@ -209,6 +169,10 @@ bool Epub::load(const bool buildIfMissing) {
 
   // Try to load existing cache first
   if (bookMetadataCache->load()) {
+    // Caches from before the zip index existed still work, but rebuild the index so item lookups stay fast
+    if (!SdMan.exists(getZipIndexPath().c_str())) {
+      ZipFile(filepath, getZipIndexPath()).buildIndex();
+    }
     Serial.printf("[%lu] [EBP] Loaded ePub: %s\n", millis(), filepath.c_str());
     return true;
   }
@@ -222,8 +186,13 @@ bool Epub::load(const bool buildIfMissing) {
   Serial.printf("[%lu] [EBP] Cache not found, building spine/TOC cache\n", millis());
   setupCacheDir();
 
+  // Index the zip central directory first so every item lookup below is a hashed lookup instead of a scan
+  if (!ZipFile(filepath, getZipIndexPath()).buildIndex()) {
+    Serial.printf("[%lu] [EBP] Could not build zip index, falling back to central directory scans\n", millis());
+  }
+
   // Begin building cache - stream entries to disk immediately
-  if (!bookMetadataCache->beginWrite()) {
+  if (!bookMetadataCache->beginWrite(filepath, getZipIndexPath())) {
     Serial.printf("[%lu] [EBP] Could not begin writing cache\n", millis());
     return false;
   }
@@ -273,22 +242,12 @@ bool Epub::load(const bool buildIfMissing) {
     return false;
   }
 
-  // Close the cache files
-  if (!bookMetadataCache->endWrite()) {
+  // Patch spine/TOC mappings and finish book.bin
+  if (!bookMetadataCache->endWrite(bookMetadata)) {
     Serial.printf("[%lu] [EBP] Could not end writing cache\n", millis());
     return false;
   }
 
-  // Build final book.bin
-  if (!bookMetadataCache->buildBookBin(filepath, bookMetadata)) {
-    Serial.printf("[%lu] [EBP] Could not update mappings and sizes\n", millis());
-    return false;
-  }
-
-  if (!bookMetadataCache->cleanupTmpFiles()) {
-    Serial.printf("[%lu] [EBP] Could not cleanup tmp files - ignoring\n", millis());
-  }
-
   // Reload the cache from disk so it's in the correct state
   bookMetadataCache.reset(new BookMetadataCache(cachePath));
   if (!bookMetadataCache->load()) {
@@ -347,6 +306,8 @@ const std::string& Epub::getAuthor() const {
 
 std::string Epub::getCoverBmpPath() const { return cachePath + "/cover.bmp"; }
 
+std::string Epub::getZipIndexPath() const { return cachePath + "/zip.idx"; }
+
 bool Epub::generateCoverBmp() const {
   // Already generated, return true
   if (SdMan.exists(getCoverBmpPath().c_str())) {
@@ -403,6 +364,85 @@ bool Epub::generateCoverBmp() const {
   return false;
 }
 
+std::string Epub::getImageBmpPath(const std::string& itemHref, const int maxWidth, const int maxHeight) const {
+  return cachePath + "/images/" + std::to_string(BookMetadataCache::hashHref(itemHref)) + "_" +
+         std::to_string(maxWidth) + "x" + std::to_string(maxHeight) + ".bmp";
+}
+
+bool Epub::getImageSize(const std::string& itemHref, const int maxWidth, const int maxHeight, int* width,
+                        int* height) const {
+  if (!isJpegHref(itemHref)) {
+    Serial.printf("[%lu] [EBP] Image %s is not a JPG, skipping\n", millis(), itemHref.c_str());
+    return false;
+  }
+
+  ZipFile::EntryReader reader;
+  if (!openItemReader(itemHref, reader, 1024)) {
+    return false;
+  }
+  const bool success = JpegToBmpConverter::jpegSizeWithin(
+      [](uint8_t* buf, const size_t len, void* source) {
+        return static_cast<ZipFile::EntryReader*>(source)->read(buf, len);
+      },
+      &reader, maxWidth, maxHeight, width, height);
+  reader.close();
+  return success;
+}
+
+bool Epub::generateImageBmp(const std::string& itemHref, const int maxWidth, const int maxHeight) const {
+  const auto imageBmpPath = getImageBmpPath(itemHref, maxWidth, maxHeight);
+  // Already generated, return true
+  if (SdMan.exists(imageBmpPath.c_str())) {
+    return true;
+  }
+
+  if (!isJpegHref(itemHref)) {
+    Serial.printf("[%lu] [EBP] Image %s is not a JPG, skipping\n", millis(), itemHref.c_str());
+    return false;
+  }
+
+  {
+    const auto imagesDir = cachePath + "/images";
+    SdMan.mkdir(imagesDir.c_str());
+  }
+
+  const auto imageJpgTempPath = getCachePath() + "/.image.jpg";
+  FsFile imageJpg;
+  if (!SdMan.openFileForWrite("EBP", imageJpgTempPath, imageJpg)) {
+    return false;
+  }
+  const bool extracted = readItemContentsToStream(itemHref, imageJpg, 1024);
+  imageJpg.close();
+
+  if (!extracted || !SdMan.openFileForRead("EBP", imageJpgTempPath, imageJpg)) {
+    SdMan.remove(imageJpgTempPath.c_str());
+    return false;
+  }
+
+  // The BMP only gets its final name once it is complete, a conversion cut short (failed read, power loss) leaves
+  // nothing behind that the exists() check above would take for a finished image
+  const auto imageBmpTempPath = imageBmpPath + ".tmp";
+  FsFile imageBmp;
+  if (!SdMan.openFileForWrite("EBP", imageBmpTempPath, imageBmp)) {
+    imageJpg.close();
+    SdMan.remove(imageJpgTempPath.c_str());
+    return false;
+  }
+  bool success = JpegToBmpConverter::jpegFileToBmpStreamWithin(imageJpg, imageBmp, maxWidth, maxHeight);
+  imageJpg.close();
+  SdMan.remove(imageJpgTempPath.c_str());
+  if (success) {
+    success = imageBmp.rename(imageBmpPath.c_str());
+  }
+  imageBmp.close();
+
+  if (!success) {
+    Serial.printf("[%lu] [EBP] Failed to generate BMP from JPG image %s\n", millis(), itemHref.c_str());
+    SdMan.remove(imageBmpTempPath.c_str());
+  }
+  return success;
+}
+
 uint8_t* Epub::readItemContentsToBytes(const std::string& itemHref, size_t* size, const bool trailingNullByte) const {
   if (itemHref.empty()) {
     Serial.printf("[%lu] [EBP] Failed to read item, empty href\n", millis());
@@ -411,7 +451,7 @@ uint8_t* Epub::readItemContentsToBytes(const std::string& itemHref, size_t* size
 
   const std::string path = FsHelpers::normalisePath(itemHref);
 
-  const auto content = ZipFile(filepath).readFileToMemory(path.c_str(), size, trailingNullByte);
+  const auto content = ZipFile(filepath, getZipIndexPath()).readFileToMemory(path.c_str(), size, trailingNullByte);
   if (!content) {
     Serial.printf("[%lu] [EBP] Failed to read item %s\n", millis(), path.c_str());
     return nullptr;
@@ -427,12 +467,22 @@ bool Epub::readItemContentsToStream(const std::string& itemHref, Print& out, con
   }
 
   const std::string path = FsHelpers::normalisePath(itemHref);
-  return ZipFile(filepath).readFileToStream(path.c_str(), out, chunkSize);
+  return ZipFile(filepath, getZipIndexPath()).readFileToStream(path.c_str(), out, chunkSize);
+}
+
+bool Epub::openItemReader(const std::string& itemHref, ZipFile::EntryReader& reader, const size_t chunkSize) const {
+  if (itemHref.empty()) {
+    Serial.printf("[%lu] [EBP] Failed to read item, empty href\n", millis());
+    return false;
+  }
+
+  const std::string path = FsHelpers::normalisePath(itemHref);
+  return ZipFile(filepath, getZipIndexPath()).openEntry(path.c_str(), reader, chunkSize);
 }
 
 bool Epub::getItemSize(const std::string& itemHref, size_t* size) const {
   const std::string path = FsHelpers::normalisePath(itemHref);
-  return ZipFile(filepath).getInflatedFileSize(path.c_str(), size);
+  return ZipFile(filepath, getZipIndexPath()).getInflatedFileSize(path.c_str(), size);
 }
 
 int Epub::getSpineItemsCount() const {
@@ -442,7 +492,19 @@ int Epub::getSpineItemsCount() const {
   return bookMetadataCache->getSpineCount();
 }
 
-size_t Epub::getCumulativeSpineItemSize(const int spineIndex) const { return getSpineItem(spineIndex).cumulativeSize; }
+size_t Epub::getCumulativeSpineItemSize(const int spineIndex) const {
+  if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
+    Serial.printf("[%lu] [EBP] getCumulativeSpineItemSize called but cache not loaded\n", millis());
+    return 0;
+  }
+
+  if (spineIndex < 0 || spineIndex >= bookMetadataCache->getSpineCount()) {
+    Serial.printf("[%lu] [EBP] getCumulativeSpineItemSize index:%d is out of range\n", millis(), spineIndex);
+    return bookMetadataCache->getSpineCumulativeSize(0);
+  }
+
+  return bookMetadataCache->getSpineCumulativeSize(spineIndex);
+}
 
 BookMetadataCache::SpineEntry Epub::getSpineItem(const int spineIndex) const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
@@ -472,6 +534,15 @@ BookMetadataCache::TocEntry Epub::getTocItem(const int tocIndex) const {
   return bookMetadataCache->getTocEntry(tocIndex);
 }
 
+std::vector<BookMetadataCache::TocTitle> Epub::getTocTitles(const int firstTocIndex, const int count) const {
+  if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
+    Serial.printf("[%lu] [EBP] getTocTitles called but cache not loaded\n", millis());
+    return {};
+  }
+
+  return bookMetadataCache->getTocTitles(firstTocIndex, count);
+}
+
 int Epub::getTocItemsCount() const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
     return 0;
@@ -501,7 +572,29 @@ int Epub::getSpineIndexForTocIndex(const int tocIndex) const {
   return spineIndex;
 }
 
-int Epub::getTocIndexForSpineIndex(const int spineIndex) const { return getSpineItem(spineIndex).tocIndex; }
+int Epub::getTocIndexForSpineIndex(const int spineIndex) const {
+  if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
+    Serial.printf("[%lu] [EBP] getTocIndexForSpineIndex called but cache not loaded\n", millis());
+    return -1;
+  }
+
+  if (spineIndex < 0 || spineIndex >= bookMetadataCache->getSpineCount()) {
+    Serial.printf("[%lu] [EBP] getTocIndexForSpineIndex index:%d is out of range\n", millis(), spineIndex);
+    return bookMetadataCache->getSpineTocIndex(0);
+  }
+
+  return bookMetadataCache->getSpineTocIndex(spineIndex);
+}
+
+// Hrefs are resolved relative to the epub root, like spine and TOC hrefs (e.g. "OEBPS/Text/ch01.xhtml")
+int Epub::getSpineIndexForHref(const std::string& href) const {
+  if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
+    Serial.printf("[%lu] [EBP] getSpineIndexForHref called but cache not loaded\n", millis());
+    return -1;
+  }
+
+  return bookMetadataCache->getSpineIndexForHref(href);
+}
 
 size_t Epub::getBookSize() const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded() || bookMetadataCache->getSpineCount() == 0) {
@@ -526,13 +619,11 @@ int Epub::getSpineIndexForTextReference() const {
     return 0;
   }
 
-  // loop through spine items to get the correct index matching the text href
-  for (size_t i = 0; i < getSpineItemsCount(); i++) {
-    if (getSpineItem(i).href == bookMetadataCache->coreMetadata.textReferenceHref) {
-      Serial.printf("[%lu] [ERS] Text reference %s found at index %d\n", millis(),
-                    bookMetadataCache->coreMetadata.textReferenceHref.c_str(), i);
-      return i;
-    }
+  const int spineIndex = bookMetadataCache->getSpineIndexForHref(bookMetadataCache->coreMetadata.textReferenceHref);
+  if (spineIndex != -1) {
+    Serial.printf("[%lu] [ERS] Text reference %s found at index %d\n", millis(),
+                  bookMetadataCache->coreMetadata.textReferenceHref.c_str(), spineIndex);
+    return spineIndex;
   }
   // This should not happen, as we checked for empty textReferenceHref earlier
   Serial.printf("[%lu] [EBP] Section not found for text reference\n", millis());
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Print.h>
+#include <ZipFile.h>
 
 #include <memory>
 #include <string>
@@ -9,8 +10,6 @@
 
 #include "Epub/BookMetadataCache.h"
 
-class ZipFile;
-
 class Epub {
   // the ncx file (EPUB 2)
   std::string tocNcxItem;
@@ -29,6 +28,7 @@ class Epub {
   bool parseContentOpf(BookMetadataCache::BookMetadata& bookMetadata);
   bool parseTocNcxFile() const;
   bool parseTocNavFile() const;
+  std::string getZipIndexPath() const;
 
  public:
   explicit Epub(std::string filepath, const std::string& cacheDir) : filepath(std::move(filepath)) {
@@ -46,16 +46,24 @@ class Epub {
   const std::string& getAuthor() const;
   std::string getCoverBmpPath() const;
   bool generateCoverBmp() const;
+  std::string getImageBmpPath(const std::string& itemHref, int maxWidth, int maxHeight) const;
+  // Size generateImageBmp will give a JPEG item, read from its headers without decoding it
+  bool getImageSize(const std::string& itemHref, int maxWidth, int maxHeight, int* width, int* height) const;
+  // Decodes a JPEG item once into a dithered 2-bit BMP that fits within maxWidth x maxHeight, kept per size
+  bool generateImageBmp(const std::string& itemHref, int maxWidth, int maxHeight) const;
   uint8_t* readItemContentsToBytes(const std::string& itemHref, size_t* size = nullptr,
                                    bool trailingNullByte = false) const;
   bool readItemContentsToStream(const std::string& itemHref, Print& out, size_t chunkSize) const;
+  bool openItemReader(const std::string& itemHref, ZipFile::EntryReader& reader, size_t chunkSize) const;
   bool getItemSize(const std::string& itemHref, size_t* size) const;
   BookMetadataCache::SpineEntry getSpineItem(int spineIndex) const;
   BookMetadataCache::TocEntry getTocItem(int tocIndex) const;
+  std::vector<BookMetadataCache::TocTitle> getTocTitles(int firstTocIndex, int count) const;
   int getSpineItemsCount() const;
   int getTocItemsCount() const;
   int getSpineIndexForTocIndex(int tocIndex) const;
   int getTocIndexForSpineIndex(int spineIndex) const;
+  int getSpineIndexForHref(const std::string& href) const;
   size_t getCumulativeSpineItemSize(int spineIndex) const;
   int getSpineIndexForTextReference() const;
 
@@ -4,267 +4,333 @@
 #include <Serialization.h>
 #include <ZipFile.h>
 
-#include <vector>
+#include <algorithm>
+#include <cstddef>
 
 #include "FsHelpers.h"
 
 namespace {
-constexpr uint8_t BOOK_CACHE_VERSION = 3;
+constexpr uint8_t BOOK_CACHE_VERSION = 7;
 constexpr char bookBinFile[] = "/book.bin";
-constexpr char tmpSpineBinFile[] = "/spine.bin.tmp";
-constexpr char tmpTocBinFile[] = "/toc.bin.tmp";
+// Href index buckets target a handful of spine items each, so a lookup is a single short read
+constexpr uint16_t HREF_ENTRIES_PER_BUCKET = 4;
+constexpr uint16_t MAX_HREF_BUCKETS = 1024;
+constexpr uint32_t HREF_RECORD_SIZE = sizeof(uint32_t) + sizeof(uint16_t);
+// TOC table rows are converted in small batches so the build never holds the whole table in memory
+constexpr uint16_t TOC_WRITE_BATCH = 32;
+
+#pragma pack(push, 1)
+struct BookHeader {
+  uint8_t version;
+  uint16_t spineCount;
+  uint16_t tocCount;
+  uint32_t spineTableOffset;
+  uint32_t cumulativeSizesOffset;
+  uint32_t tocTableOffset;
+  uint32_t hrefIndexOffset;
+  // Metadata string pool offsets
+  uint32_t titleOffset;
+  uint32_t authorOffset;
+  uint32_t coverItemHrefOffset;
+  uint32_t textReferenceHrefOffset;
+};
+
+struct SpineRecord {
+  uint32_t hrefOffset;
+  int16_t tocIndex;
+};
+
+struct TocRecord {
+  uint32_t titleOffset;
+  uint32_t hrefOffset;
+  uint32_t anchorOffset;
+  uint8_t level;
+  int16_t spineIndex;
+};
+#pragma pack(pop)
+
+// Skips a length prefixed string, returning its offset
+uint32_t skipString(FsFile& file) {
+  const uint32_t offset = file.position();
+  uint32_t len;
+  serialization::readPod(file, len);
+  file.seek(offset + sizeof(len) + len);
+  return offset;
+}
 }  // namespace
 
+uint32_t BookMetadataCache::hashHref(const std::string& path) {
+  uint32_t hash = 2166136261u;
+  for (const char c : path) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+BookMetadataCache::~BookMetadataCache() = default;
+
 /* ============= WRITING / BUILDING FUNCTIONS ================ */
 
-bool BookMetadataCache::beginWrite() {
+bool BookMetadataCache::beginWrite(const std::string& epubPath, const std::string& zipIndexPath) {
   buildMode = true;
   spineCount = 0;
   tocCount = 0;
+  cumulativeSize = 0;
+  spineBuildEntries.clear();
+  tocBuildEntries.clear();
   Serial.printf("[%lu] [BMC] Entering write mode\n", millis());
+
+  if (!SdMan.openFileForWrite("BMC", cachePath + bookBinFile, bookFile)) {
+    buildMode = false;
+    return false;
+  }
+
+  // Header is written zeroed (so with an invalid version) and patched once the file is complete, so a partially
+  // written book.bin is never loaded. The string pool follows it directly.
+  const BookHeader header = {};
+  bookFile.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+
+  // Zip is kept open for the whole build so spine item sizes can be looked up as entries are created
+  this->epubPath = epubPath;
+  zip.reset(new ZipFile(this->epubPath, zipIndexPath));
+  if (!zip->open()) {
+    Serial.printf("[%lu] [BMC] Could not open EPUB zip for size calculations\n", millis());
+    zip.reset();
+    bookFile.close();
+    buildMode = false;
+    return false;
+  }
   return true;
 }
 
 bool BookMetadataCache::beginContentOpfPass() {
   Serial.printf("[%lu] [BMC] Beginning content opf pass\n", millis());
-
-  // Open spine file for writing
-  return SdMan.openFileForWrite("BMC", cachePath + tmpSpineBinFile, spineFile);
+  return buildMode && bookFile;
 }
 
 bool BookMetadataCache::endContentOpfPass() {
-  spineFile.close();
+  tocStringsStart = bookFile.position();
+  buildHrefBuckets();
+  // Spine hrefs are read back while resolving TOC hrefs, make sure they're on the card first
+  bookFile.flush();
   return true;
 }
 
 bool BookMetadataCache::beginTocPass() {
   Serial.printf("[%lu] [BMC] Beginning toc pass\n", millis());
 
-  // Open spine file for reading
-  if (!SdMan.openFileForRead("BMC", cachePath + tmpSpineBinFile, spineFile)) {
-    return false;
-  }
-  if (!SdMan.openFileForWrite("BMC", cachePath + tmpTocBinFile, tocFile)) {
-    spineFile.close();
+  if (!SdMan.openFileForRead("BMC", cachePath + bookBinFile, spineReadFile)) {
     return false;
   }
   return true;
 }
 
 bool BookMetadataCache::endTocPass() {
-  tocFile.close();
-  spineFile.close();
+  spineReadFile.close();
   return true;
 }
 
-bool BookMetadataCache::endWrite() {
+bool BookMetadataCache::endWrite(const BookMetadata& metadata) {
   if (!buildMode) {
     Serial.printf("[%lu] [BMC] endWrite called but not in build mode\n", millis());
     return false;
   }
 
   buildMode = false;
-  Serial.printf("[%lu] [BMC] Wrote %d spine, %d TOC entries\n", millis(), spineCount, tocCount);
-  return true;
-}
-
-bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMetadata& metadata) {
-  // Open all three files, writing to meta, reading from spine and toc
-  if (!SdMan.openFileForWrite("BMC", cachePath + bookBinFile, bookFile)) {
-    return false;
-  }
-
-  if (!SdMan.openFileForRead("BMC", cachePath + tmpSpineBinFile, spineFile)) {
-    bookFile.close();
-    return false;
-  }
-
-  if (!SdMan.openFileForRead("BMC", cachePath + tmpTocBinFile, tocFile)) {
-    bookFile.close();
-    spineFile.close();
-    return false;
-  }
-
-  constexpr uint32_t headerASize =
-      sizeof(BOOK_CACHE_VERSION) + /* LUT Offset */ sizeof(uint32_t) + sizeof(spineCount) + sizeof(tocCount);
-  const uint32_t metadataSize = metadata.title.size() + metadata.author.size() + metadata.coverItemHref.size() +
-                                metadata.textReferenceHref.size() + sizeof(uint32_t) * 4;
-  const uint32_t lutSize = sizeof(uint32_t) * spineCount + sizeof(uint32_t) * tocCount;
-  const uint32_t lutOffset = headerASize + metadataSize;
-
-  // Header A
-  serialization::writePod(bookFile, BOOK_CACHE_VERSION);
-  serialization::writePod(bookFile, lutOffset);
-  serialization::writePod(bookFile, spineCount);
-  serialization::writePod(bookFile, tocCount);
-  // Metadata
-  serialization::writeString(bookFile, metadata.title);
-  serialization::writeString(bookFile, metadata.author);
-  serialization::writeString(bookFile, metadata.coverItemHref);
-  serialization::writeString(bookFile, metadata.textReferenceHref);
-
-  // Loop through spine entries, writing LUT positions
-  spineFile.seek(0);
+  zip.reset();
+
+  BookHeader header = {};
+  header.spineCount = spineCount;
+  header.tocCount = tocCount;
+  header.titleOffset = writeString(metadata.title);
+  header.authorOffset = writeString(metadata.author);
+  header.coverItemHrefOffset = writeString(metadata.coverItemHref);
+  header.textReferenceHrefOffset = writeString(metadata.textReferenceHref);
+
+  // Spine table, spine items without a TOC entry of their own use the title from the last section
+  header.spineTableOffset = bookFile.position();
+  int16_t lastSpineTocIndex = -1;
   for (int i = 0; i < spineCount; i++) {
-    uint32_t pos = spineFile.position();
-    auto spineEntry = readSpineEntry(spineFile);
-    serialization::writePod(bookFile, pos + lutOffset + lutSize);
-  }
-
-  // Loop through toc entries, writing LUT positions
-  tocFile.seek(0);
-  for (int i = 0; i < tocCount; i++) {
-    uint32_t pos = tocFile.position();
-    auto tocEntry = readTocEntry(tocFile);
-    serialization::writePod(bookFile, pos + lutOffset + lutSize + static_cast<uint32_t>(spineFile.position()));
-  }
-
-  // LUTs complete
-  // Loop through spines from spine file matching up TOC indexes, calculating cumulative size and writing to book.bin
+    auto& spineEntry = spineBuildEntries[i];
 
-  ZipFile zip(epubPath);
-  // Pre-open zip file to speed up size calculations
-  if (!zip.open()) {
-    Serial.printf("[%lu] [BMC] Could not open EPUB zip for size calculations\n", millis());
-    bookFile.close();
-    spineFile.close();
-    tocFile.close();
-    return false;
-  }
-  // TODO: For large ZIPs loading the all localHeaderOffsets will crash.
-  //       However not having them loaded is extremely slow. Need a better solution here.
-  //       Perhaps only a cache of spine items or a better way to speedup lookups?
-  if (!zip.loadAllFileStatSlims()) {
-    Serial.printf("[%lu] [BMC] Could not load zip local header offsets for size calculations\n", millis());
-    bookFile.close();
-    spineFile.close();
-    tocFile.close();
-    zip.close();
-    return false;
-  }
-  uint32_t cumSize = 0;
-  spineFile.seek(0);
-  int lastSpineTocIndex = -1;
-  for (int i = 0; i < spineCount; i++) {
-    auto spineEntry = readSpineEntry(spineFile);
-
-    tocFile.seek(0);
-    for (int j = 0; j < tocCount; j++) {
-      auto tocEntry = readTocEntry(tocFile);
-      if (tocEntry.spineIndex == i) {
-        spineEntry.tocIndex = j;
-        break;
-      }
-    }
-
-    // Not a huge deal if we don't fine a TOC entry for the spine entry, this is expected behaviour for EPUBs
+    // Not a huge deal if we don't find a TOC entry for the spine entry, this is expected behaviour for EPUBs
     // Logging here is for debugging
     if (spineEntry.tocIndex == -1) {
-      Serial.printf(
-          "[%lu] [BMC] Warning: Could not find TOC entry for spine item %d: %s, using title from last section\n",
-          millis(), i, spineEntry.href.c_str());
+      Serial.printf("[%lu] [BMC] Warning: Could not find TOC entry for spine item %d, using title from last section\n",
+                    millis(), i);
       spineEntry.tocIndex = lastSpineTocIndex;
     }
     lastSpineTocIndex = spineEntry.tocIndex;
 
-    // Calculate size for cumulative size
-    size_t itemSize = 0;
-    const std::string path = FsHelpers::normalisePath(spineEntry.href);
-    if (zip.getInflatedFileSize(path.c_str(), &itemSize)) {
-      cumSize += itemSize;
-      spineEntry.cumulativeSize = cumSize;
-    } else {
-      Serial.printf("[%lu] [BMC] Warning: Could not get size for spine item: %s\n", millis(), path.c_str());
-    }
+    const SpineRecord record = {spineEntry.hrefOffset, spineEntry.tocIndex};
+    bookFile.write(reinterpret_cast<const uint8_t*>(&record), sizeof(record));
+  }
 
-    // Write out spine data to book.bin
-    writeSpineEntry(bookFile, spineEntry);
+  header.cumulativeSizesOffset = bookFile.position();
+  for (const auto& spineEntry : spineBuildEntries) {
+    serialization::writePod(bookFile, spineEntry.cumulativeSize);
   }
-  // Close opened zip file
-  zip.close();
 
-  // Loop through toc entries from toc file writing to book.bin
-  tocFile.seek(0);
-  for (int i = 0; i < tocCount; i++) {
-    auto tocEntry = readTocEntry(tocFile);
-    writeTocEntry(bookFile, tocEntry);
+  header.tocTableOffset = bookFile.position();
+  if (!writeTocTable()) {
+    bookFile.close();
+    return false;
   }
 
+  header.hrefIndexOffset = bookFile.position();
+  writeHrefIndex();
+
+  // Finally make the file valid
+  header.version = BOOK_CACHE_VERSION;
+  bookFile.seek(0);
+  bookFile.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
   bookFile.close();
-  spineFile.close();
-  tocFile.close();
 
-  Serial.printf("[%lu] [BMC] Successfully built book.bin\n", millis());
+  std::vector<SpineBuildEntry>().swap(spineBuildEntries);
+  std::vector<TocBuildEntry>().swap(tocBuildEntries);
+  std::vector<uint16_t>().swap(hrefBucketStarts);
+  std::vector<uint16_t>().swap(hrefBucketOrder);
+
+  Serial.printf("[%lu] [BMC] Wrote %d spine, %d TOC entries\n", millis(), spineCount, tocCount);
   return true;
 }
 
-bool BookMetadataCache::cleanupTmpFiles() const {
-  if (SdMan.exists((cachePath + tmpSpineBinFile).c_str())) {
-    SdMan.remove((cachePath + tmpSpineBinFile).c_str());
+uint32_t BookMetadataCache::writeString(const std::string& s) {
+  const uint32_t offset = bookFile.position();
+  serialization::writeString(bookFile, s);
+  return offset;
+}
+
+// TOC strings were written to the pool as title, href, anchor triples in TOC order. Rather than keeping three
+// offsets per entry in memory for the whole build, walk the triples once to recover them.
+bool BookMetadataCache::writeTocTable() {
+  bookFile.flush();
+  FsFile poolFile;
+  if (!SdMan.openFileForRead("BMC", cachePath + bookBinFile, poolFile)) {
+    return false;
   }
-  if (SdMan.exists((cachePath + tmpTocBinFile).c_str())) {
-    SdMan.remove((cachePath + tmpTocBinFile).c_str());
+  poolFile.seek(tocStringsStart);
+
+  TocRecord batch[TOC_WRITE_BATCH];
+  uint16_t batchSize = 0;
+  for (const auto& tocEntry : tocBuildEntries) {
+    auto& record = batch[batchSize++];
+    record.titleOffset = skipString(poolFile);
+    record.hrefOffset = skipString(poolFile);
+    record.anchorOffset = skipString(poolFile);
+    record.level = tocEntry.level;
+    record.spineIndex = tocEntry.spineIndex;
+
+    if (batchSize == TOC_WRITE_BATCH) {
+      bookFile.write(reinterpret_cast<const uint8_t*>(batch), sizeof(TocRecord) * batchSize);
+      batchSize = 0;
+    }
   }
+  bookFile.write(reinterpret_cast<const uint8_t*>(batch), sizeof(TocRecord) * batchSize);
+
+  poolFile.close();
   return true;
 }
 
-uint32_t BookMetadataCache::writeSpineEntry(FsFile& file, const SpineEntry& entry) const {
-  const uint32_t pos = file.position();
-  serialization::writeString(file, entry.href);
-  serialization::writePod(file, entry.cumulativeSize);
-  serialization::writePod(file, entry.tocIndex);
-  return pos;
+// Groups spine indexes by href hash bucket, used for TOC resolution and persisted as the href index
+void BookMetadataCache::buildHrefBuckets() {
+  hrefBucketCount = 1;
+  while (hrefBucketCount < MAX_HREF_BUCKETS && hrefBucketCount * HREF_ENTRIES_PER_BUCKET < spineCount) {
+    hrefBucketCount <<= 1;
+  }
+
+  hrefBucketStarts.assign(hrefBucketCount + 1, 0);
+  hrefBucketOrder.resize(spineCount);
+
+  // Counting sort of spine indexes by bucket, stable so the first spine item wins on duplicate hrefs
+  for (const auto& spineEntry : spineBuildEntries) {
+    hrefBucketStarts[(spineEntry.hrefHash & (hrefBucketCount - 1)) + 1]++;
+  }
+  for (uint16_t i = 0; i < hrefBucketCount; i++) {
+    hrefBucketStarts[i + 1] += hrefBucketStarts[i];
+  }
+  std::vector<uint16_t> cursor(hrefBucketStarts.begin(), hrefBucketStarts.end() - 1);
+  for (uint16_t i = 0; i < spineCount; i++) {
+    hrefBucketOrder[cursor[spineBuildEntries[i].hrefHash & (hrefBucketCount - 1)]++] = i;
+  }
 }
 
-uint32_t BookMetadataCache::writeTocEntry(FsFile& file, const TocEntry& entry) const {
-  const uint32_t pos = file.position();
-  serialization::writeString(file, entry.title);
-  serialization::writeString(file, entry.href);
-  serialization::writeString(file, entry.anchor);
-  serialization::writePod(file, entry.level);
-  serialization::writePod(file, entry.spineIndex);
-  return pos;
+// Href index layout: u16 bucketCount, u16 bucketStarts[bucketCount + 1], then {u32 hrefHash, u16 spineIndex} records
+// grouped by bucket (hash & (bucketCount - 1)) and in spine order within a bucket
+void BookMetadataCache::writeHrefIndex() {
+  serialization::writePod(bookFile, hrefBucketCount);
+  for (const uint16_t start : hrefBucketStarts) {
+    serialization::writePod(bookFile, start);
+  }
+  for (const uint16_t spineIndex : hrefBucketOrder) {
+    serialization::writePod(bookFile, spineBuildEntries[spineIndex].hrefHash);
+    serialization::writePod(bookFile, spineIndex);
+  }
 }
 
-// Note: for the LUT to be accurate, this **MUST** be called for all spine items before `addTocEntry` is ever called
-// this is because in this function we're marking positions of the items
+// Note: this **MUST** be called for all spine items before `addTocEntry` is ever called
+// as TOC entries are resolved against the spine entries written here
 void BookMetadataCache::createSpineEntry(const std::string& href) {
-  if (!buildMode || !spineFile) {
+  if (!buildMode || !bookFile) {
     Serial.printf("[%lu] [BMC] createSpineEntry called but not in build mode\n", millis());
     return;
   }
 
-  const SpineEntry entry(href, 0, -1);
-  writeSpineEntry(spineFile, entry);
+  // Calculate size for cumulative size
+  size_t itemSize = 0;
+  const std::string path = FsHelpers::normalisePath(href);
+  if (zip->getInflatedFileSize(path.c_str(), &itemSize)) {
+    cumulativeSize += itemSize;
+  } else {
+    Serial.printf("[%lu] [BMC] Warning: Could not get size for spine item: %s\n", millis(), path.c_str());
+  }
+
+  // Always the running total, even for items without a size, so the column stays sorted for the offset search
+  spineBuildEntries.push_back({writeString(href), hashHref(path), cumulativeSize, -1});
   spineCount++;
 }
 
+int BookMetadataCache::findSpineIndex(const std::string& path) {
+  const uint32_t hrefHash = hashHref(path);
+  const uint16_t bucket = hrefHash & (hrefBucketCount - 1);
+  for (uint16_t j = hrefBucketStarts[bucket]; j < hrefBucketStarts[bucket + 1]; j++) {
+    const uint16_t i = hrefBucketOrder[j];
+    if (spineBuildEntries[i].hrefHash != hrefHash) {
+      continue;
+    }
+
+    // Hash matched, confirm against the href in the string pool
+    std::string spineHref;
+    spineReadFile.seek(spineBuildEntries[i].hrefOffset);
+    serialization::readString(spineReadFile, spineHref);
+    if (FsHelpers::normalisePath(spineHref) == path) {
+      return i;
+    }
+  }
+  return -1;
+}
+
 void BookMetadataCache::createTocEntry(const std::string& title, const std::string& href, const std::string& anchor,
                                        const uint8_t level) {
-  if (!buildMode || !tocFile || !spineFile) {
+  if (!buildMode || !bookFile || !spineReadFile) {
     Serial.printf("[%lu] [BMC] createTocEntry called but not in build mode\n", millis());
     return;
   }
 
-  int spineIndex = -1;
-  // find spine index
-  // TODO: This lookup is slow as need to scan through all items each time. We can't hold it all in memory due to size.
-  //       But perhaps we can load just the hrefs in a vector/list to do an index lookup?
-  spineFile.seek(0);
-  for (int i = 0; i < spineCount; i++) {
-    auto spineEntry = readSpineEntry(spineFile);
-    if (spineEntry.href == href) {
-      spineIndex = i;
-      break;
-    }
-  }
-
+  const int spineIndex = findSpineIndex(FsHelpers::normalisePath(href));
   if (spineIndex == -1) {
     Serial.printf("[%lu] [BMC] addTocEntry: Could not find spine item for TOC href %s\n", millis(), href.c_str());
+  } else if (spineBuildEntries[spineIndex].tocIndex == -1) {
+    // Spine entries map to the first TOC entry that points at them
+    spineBuildEntries[spineIndex].tocIndex = static_cast<int16_t>(tocCount);
   }
 
-  const TocEntry entry(title, href, anchor, level, spineIndex);
-  writeTocEntry(tocFile, entry);
+  // Strings must stay in title, href, anchor order, writeTocTable walks them to build the TOC table
+  writeString(title);
+  writeString(href);
+  writeString(anchor);
+  tocBuildEntries.push_back({level, static_cast<int16_t>(spineIndex)});
   tocCount++;
 }
 
@@ -275,28 +341,50 @@ bool BookMetadataCache::load() {
     return false;
   }
 
-  uint8_t version;
-  serialization::readPod(bookFile, version);
-  if (version != BOOK_CACHE_VERSION) {
-    Serial.printf("[%lu] [BMC] Cache version mismatch: expected %d, got %d\n", millis(), BOOK_CACHE_VERSION, version);
+  BookHeader header = {};
+  bookFile.read(reinterpret_cast<uint8_t*>(&header), sizeof(header));
+  if (header.version != BOOK_CACHE_VERSION) {
+    Serial.printf("[%lu] [BMC] Cache version mismatch: expected %d, got %d\n", millis(), BOOK_CACHE_VERSION,
+                  header.version);
     bookFile.close();
     return false;
   }
 
-  serialization::readPod(bookFile, lutOffset);
-  serialization::readPod(bookFile, spineCount);
-  serialization::readPod(bookFile, tocCount);
+  spineCount = header.spineCount;
+  tocCount = header.tocCount;
+  spineTableOffset = header.spineTableOffset;
+  cumulativeSizesOffset = header.cumulativeSizesOffset;
+  tocTableOffset = header.tocTableOffset;
+  hrefIndexOffset = header.hrefIndexOffset;
+
+  bookFile.seek(hrefIndexOffset);
+  serialization::readPod(bookFile, hrefBucketCount);
 
-  serialization::readString(bookFile, coreMetadata.title);
-  serialization::readString(bookFile, coreMetadata.author);
-  serialization::readString(bookFile, coreMetadata.coverItemHref);
-  serialization::readString(bookFile, coreMetadata.textReferenceHref);
+  readStringAt(header.titleOffset, coreMetadata.title);
+  readStringAt(header.authorOffset, coreMetadata.author);
+  readStringAt(header.coverItemHrefOffset, coreMetadata.coverItemHref);
+  readStringAt(header.textReferenceHrefOffset, coreMetadata.textReferenceHref);
 
   loaded = true;
   Serial.printf("[%lu] [BMC] Loaded cache data: %d spine, %d TOC entries\n", millis(), spineCount, tocCount);
   return true;
 }
 
+void BookMetadataCache::readStringAt(const uint32_t offset, std::string& s) {
+  bookFile.seek(offset);
+  serialization::readString(bookFile, s);
+}
+
+std::string BookMetadataCache::readSpineHref(const int index) {
+  uint32_t hrefOffset;
+  bookFile.seek(spineTableOffset + sizeof(SpineRecord) * index);
+  serialization::readPod(bookFile, hrefOffset);
+
+  std::string href;
+  readStringAt(hrefOffset, href);
+  return href;
+}
+
 BookMetadataCache::SpineEntry BookMetadataCache::getSpineEntry(const int index) {
   if (!loaded) {
     Serial.printf("[%lu] [BMC] getSpineEntry called but cache not loaded\n", millis());
@@ -308,12 +396,56 @@ BookMetadataCache::SpineEntry BookMetadataCache::getSpineEntry(const int index)
     return {};
   }
 
-  // Seek to spine LUT item, read from LUT and get out data
-  bookFile.seek(lutOffset + sizeof(uint32_t) * index);
-  uint32_t spineEntryPos;
-  serialization::readPod(bookFile, spineEntryPos);
-  bookFile.seek(spineEntryPos);
-  return readSpineEntry(bookFile);
+  if (const auto* cached = spineEntryCache.find(index)) {
+    return *cached;
+  }
+
+  const SpineFields fields = getSpineFields(index);
+  SpineEntry entry(readSpineHref(index), fields.cumulativeSize, fields.tocIndex);
+  spineEntryCache.put(index, entry);
+  return entry;
+}
+
+BookMetadataCache::SpineFields BookMetadataCache::getSpineFields(const int index) {
+  if (const auto* cached = spineFieldCache.find(index)) {
+    return *cached;
+  }
+
+  SpineFields fields;
+  bookFile.seek(spineTableOffset + sizeof(SpineRecord) * index + offsetof(SpineRecord, tocIndex));
+  serialization::readPod(bookFile, fields.tocIndex);
+  bookFile.seek(cumulativeSizesOffset + sizeof(uint32_t) * index);
+  serialization::readPod(bookFile, fields.cumulativeSize);
+  spineFieldCache.put(index, fields);
+  return fields;
+}
+
+uint32_t BookMetadataCache::getSpineCumulativeSize(const int index) {
+  if (!loaded) {
+    Serial.printf("[%lu] [BMC] getSpineCumulativeSize called but cache not loaded\n", millis());
+    return 0;
+  }
+
+  if (index < 0 || index >= static_cast<int>(spineCount)) {
+    Serial.printf("[%lu] [BMC] getSpineCumulativeSize index %d out of range\n", millis(), index);
+    return 0;
+  }
+
+  return getSpineFields(index).cumulativeSize;
+}
+
+int16_t BookMetadataCache::getSpineTocIndex(const int index) {
+  if (!loaded) {
+    Serial.printf("[%lu] [BMC] getSpineTocIndex called but cache not loaded\n", millis());
+    return -1;
+  }
+
+  if (index < 0 || index >= static_cast<int>(spineCount)) {
+    Serial.printf("[%lu] [BMC] getSpineTocIndex index %d out of range\n", millis(), index);
+    return -1;
+  }
+
+  return getSpineFields(index).tocIndex;
 }
 
 BookMetadataCache::TocEntry BookMetadataCache::getTocEntry(const int index) {
@@ -327,28 +459,86 @@ BookMetadataCache::TocEntry BookMetadataCache::getTocEntry(const int index) {
     return {};
   }
 
-  // Seek to TOC LUT item, read from LUT and get out data
-  bookFile.seek(lutOffset + sizeof(uint32_t) * spineCount + sizeof(uint32_t) * index);
-  uint32_t tocEntryPos;
-  serialization::readPod(bookFile, tocEntryPos);
-  bookFile.seek(tocEntryPos);
-  return readTocEntry(bookFile);
-}
+  if (const auto* cached = tocEntryCache.find(index)) {
+    return *cached;
+  }
 
-BookMetadataCache::SpineEntry BookMetadataCache::readSpineEntry(FsFile& file) const {
-  SpineEntry entry;
-  serialization::readString(file, entry.href);
-  serialization::readPod(file, entry.cumulativeSize);
-  serialization::readPod(file, entry.tocIndex);
-  return entry;
-}
+  TocRecord record;
+  bookFile.seek(tocTableOffset + sizeof(TocRecord) * index);
+  bookFile.read(reinterpret_cast<uint8_t*>(&record), sizeof(record));
 
-BookMetadataCache::TocEntry BookMetadataCache::readTocEntry(FsFile& file) const {
   TocEntry entry;
-  serialization::readString(file, entry.title);
-  serialization::readString(file, entry.href);
-  serialization::readString(file, entry.anchor);
-  serialization::readPod(file, entry.level);
-  serialization::readPod(file, entry.spineIndex);
+  readStringAt(record.titleOffset, entry.title);
+  readStringAt(record.hrefOffset, entry.href);
+  readStringAt(record.anchorOffset, entry.anchor);
+  entry.level = record.level;
+  entry.spineIndex = record.spineIndex;
+  tocEntryCache.put(index, entry);
   return entry;
 }
+
+std::vector<BookMetadataCache::TocTitle> BookMetadataCache::getTocTitles(const int first, const int count) {
+  std::vector<TocTitle> titles;
+  if (!loaded) {
+    Serial.printf("[%lu] [BMC] getTocTitles called but cache not loaded\n", millis());
+    return titles;
+  }
+
+  const int start = std::max(first, 0);
+  const int end = std::min(first + count, static_cast<int>(tocCount));
+  if (start >= end) {
+    return titles;
+  }
+
+  // One read for the slice of the TOC table, the titles it points at sit close together in the string pool
+  std::vector<TocRecord> records(end - start);
+  bookFile.seek(tocTableOffset + sizeof(TocRecord) * start);
+  bookFile.read(reinterpret_cast<uint8_t*>(records.data()), sizeof(TocRecord) * records.size());
+
+  titles.resize(records.size());
+  for (size_t i = 0; i < records.size(); i++) {
+    readStringAt(records[i].titleOffset, titles[i].title);
+    titles[i].level = records[i].level;
+  }
+  return titles;
+}
+
+int BookMetadataCache::getSpineIndexForHref(const std::string& href) {
+  if (!loaded) {
+    Serial.printf("[%lu] [BMC] getSpineIndexForHref called but cache not loaded\n", millis());
+    return -1;
+  }
+
+  if (hrefBucketCount == 0) {
+    return -1;
+  }
+
+  const std::string path = FsHelpers::normalisePath(href);
+  const uint32_t hrefHash = hashHref(path);
+  const uint16_t bucket = hrefHash & (hrefBucketCount - 1);
+
+  uint16_t start;
+  uint16_t end;
+  bookFile.seek(hrefIndexOffset + sizeof(uint16_t) * (1 + bucket));
+  serialization::readPod(bookFile, start);
+  serialization::readPod(bookFile, end);
+
+  const uint32_t recordsOffset = hrefIndexOffset + sizeof(uint16_t) * (hrefBucketCount + 2);
+  bookFile.seek(recordsOffset + HREF_RECORD_SIZE * start);
+  for (uint16_t i = start; i < end; i++) {
+    uint32_t recordHash;
+    uint16_t spineIndex;
+    serialization::readPod(bookFile, recordHash);
+    serialization::readPod(bookFile, spineIndex);
+    if (recordHash != hrefHash) {
+      continue;
+    }
+
+    // Hash matched, confirm against the spine href and carry on through the bucket on a collision
+    if (FsHelpers::normalisePath(readSpineHref(spineIndex)) == path) {
+      return spineIndex;
+    }
+    bookFile.seek(recordsOffset + HREF_RECORD_SIZE * (i + 1));
+  }
+  return -1;
+}
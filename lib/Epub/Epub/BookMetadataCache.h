@@ -1,8 +1,11 @@
 #pragma once
 
 #include <SDCardManager.h>
+#include <ZipFile.h>
 
+#include <memory>
 #include <string>
+#include <vector>
 
 class BookMetadataCache {
  public:
@@ -39,50 +42,152 @@ class BookMetadataCache {
           spineIndex(spineIndex) {}
   };
 
+  struct TocTitle {
+    std::string title;
+    uint8_t level;
+  };
+
  private:
+  // Tiny least recently used cache of decoded entries, the reader only ever touches a handful of entries at a time
+  template <typename T, size_t N>
+  struct EntryLru {
+    struct Slot {
+      int index = -1;
+      uint32_t lastUse = 0;
+      T value;
+    };
+    Slot slots[N];
+    uint32_t useCounter = 0;
+
+    const T* find(const int index) {
+      for (auto& slot : slots) {
+        if (slot.index == index) {
+          slot.lastUse = ++useCounter;
+          return &slot.value;
+        }
+      }
+      return nullptr;
+    }
+
+    void put(const int index, T value) {
+      Slot* victim = &slots[0];
+      for (auto& slot : slots) {
+        if (slot.index == -1) {
+          victim = &slot;
+          break;
+        }
+        if (slot.lastUse < victim->lastUse) {
+          victim = &slot;
+        }
+      }
+      victim->index = index;
+      victim->lastUse = ++useCounter;
+      victim->value = std::move(value);
+    }
+  };
+
+  // Fixed width spine fields, cached separately so integer lookups never allocate
+  struct SpineFields {
+    uint32_t cumulativeSize;
+    int16_t tocIndex;
+  };
+
+  // Per entry state kept while building. Strings go straight into the string pool, the fixed stride tables are
+  // written from this state in endWrite
+  struct SpineBuildEntry {
+    uint32_t hrefOffset;
+    uint32_t hrefHash;
+    uint32_t cumulativeSize;
+    int16_t tocIndex;
+  };
+
+  struct TocBuildEntry {
+    uint8_t level;
+    int16_t spineIndex;
+  };
+
   std::string cachePath;
-  size_t lutOffset;
+  uint32_t spineTableOffset;
+  uint32_t cumulativeSizesOffset;
+  uint32_t tocTableOffset;
+  uint32_t hrefIndexOffset;
+  uint16_t hrefBucketCount;
   uint16_t spineCount;
   uint16_t tocCount;
   bool loaded;
   bool buildMode;
 
   FsFile bookFile;
-  // Temp file handles during build
-  FsFile spineFile;
-  FsFile tocFile;
+  // Build state
+  std::string epubPath;
+  std::unique_ptr<ZipFile> zip;
+  FsFile spineReadFile;
+  std::vector<SpineBuildEntry> spineBuildEntries;
+  std::vector<TocBuildEntry> tocBuildEntries;
+  // Spine indexes grouped by href hash bucket, built at the end of the content opf pass
+  std::vector<uint16_t> hrefBucketStarts;
+  std::vector<uint16_t> hrefBucketOrder;
+  uint32_t tocStringsStart;
+  uint32_t cumulativeSize;
+
+  EntryLru<SpineEntry, 4> spineEntryCache;
+  EntryLru<TocEntry, 4> tocEntryCache;
+  EntryLru<SpineFields, 8> spineFieldCache;
 
-  uint32_t writeSpineEntry(FsFile& file, const SpineEntry& entry) const;
-  uint32_t writeTocEntry(FsFile& file, const TocEntry& entry) const;
-  SpineEntry readSpineEntry(FsFile& file) const;
-  TocEntry readTocEntry(FsFile& file) const;
+  uint32_t writeString(const std::string& s);
+  void readStringAt(uint32_t offset, std::string& s);
+  std::string readSpineHref(int index);
+  SpineFields getSpineFields(int index);
+  int findSpineIndex(const std::string& path);
+  void buildHrefBuckets();
+  bool writeTocTable();
+  void writeHrefIndex();
 
  public:
   BookMetadata coreMetadata;
 
   explicit BookMetadataCache(std::string cachePath)
-      : cachePath(std::move(cachePath)), lutOffset(0), spineCount(0), tocCount(0), loaded(false), buildMode(false) {}
-  ~BookMetadataCache() = default;
+      : cachePath(std::move(cachePath)),
+        spineTableOffset(0),
+        cumulativeSizesOffset(0),
+        tocTableOffset(0),
+        hrefIndexOffset(0),
+        hrefBucketCount(0),
+        spineCount(0),
+        tocCount(0),
+        loaded(false),
+        buildMode(false),
+        tocStringsStart(0),
+        cumulativeSize(0) {}
+  ~BookMetadataCache();
 
-  // Building phase (stream to disk immediately)
-  bool beginWrite();
+  // Building phase (stream straight into book.bin)
+  bool beginWrite(const std::string& epubPath, const std::string& zipIndexPath);
   bool beginContentOpfPass();
   void createSpineEntry(const std::string& href);
   bool endContentOpfPass();
   bool beginTocPass();
   void createTocEntry(const std::string& title, const std::string& href, const std::string& anchor, uint8_t level);
   bool endTocPass();
-  bool endWrite();
-  bool cleanupTmpFiles() const;
-
-  // Post-processing to update mappings and sizes
-  bool buildBookBin(const std::string& epubPath, const BookMetadata& metadata);
+  // Appends metadata, the spine/TOC tables and the href index, then marks the file valid
+  bool endWrite(const BookMetadata& metadata);
 
   // Reading phase (read mode)
   bool load();
   SpineEntry getSpineEntry(int index);
   TocEntry getTocEntry(int index);
+  // Integer only accessors, these never touch the string pool
+  uint32_t getSpineCumulativeSize(int index);
+  int16_t getSpineTocIndex(int index);
+  // Reads titles for TOC entries [first, first + count) with a single read of the TOC table
+  std::vector<TocTitle> getTocTitles(int first, int count);
+  // Resolves an href to its spine index through the persisted href hash index, -1 if not in the spine
+  int getSpineIndexForHref(const std::string& href);
   int getSpineCount() const { return spineCount; }
   int getTocCount() const { return tocCount; }
   bool isLoaded() const { return loaded; }
+
+  // FNV-1a over a normalised href. Persisted in book.bin and used for cache file names, so it must stay stable across
+  // builds
+  static uint32_t hashHref(const std::string& path);
 };
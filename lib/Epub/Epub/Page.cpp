@@ -1,69 +1,190 @@
 #include "Page.h"
 
+#include <GfxRenderer.h>
 #include <HardwareSerial.h>
+#include <SDCardManager.h>
 #include <Serialization.h>
 
-void PageLine::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) {
-  block->render(renderer, fontId, xPos + xOffset, yPos + yOffset);
-}
-
-bool PageLine::serialize(FsFile& file) {
-  serialization::writePod(file, xPos);
-  serialization::writePod(file, yPos);
+namespace {
+// Word offsets are 16 bit, which also caps the size of a page record
+constexpr uint32_t MAX_PAGE_RECORD_SIZE = UINT16_MAX;
+// Dictionary size and element count
+constexpr uint32_t RECORD_HEADER_SIZE = 2 * sizeof(uint16_t);
 
-  // serialize TextBlock pointed to by PageLine
-  return block->serialize(file);
+void appendU16(std::vector<uint8_t>& out, const uint16_t value) {
+  out.push_back(value & 0xFF);
+  out.push_back(value >> 8);
 }
+}  // namespace
 
-std::unique_ptr<PageLine> PageLine::deserialize(FsFile& file) {
-  int16_t xPos;
-  int16_t yPos;
-  serialization::readPod(file, xPos);
-  serialization::readPod(file, yPos);
+void PageBuilder::addLine(const TextBlock& line, const int16_t xPos, const int16_t yPos) {
+  elements.push_back(TAG_PageLine);
+  serialization::writeSignedVarint(elements, xPos);
+  serialization::writeSignedVarint(elements, yPos);
+  line.serialize(elements, dictionary);
+  elementCount++;
+}
 
-  auto tb = TextBlock::deserialize(file);
-  return std::unique_ptr<PageLine>(new PageLine(std::move(tb), xPos, yPos));
+void PageBuilder::addImage(const std::string& bmpPath, const std::string& itemHref, const int16_t xPos,
+                           const int16_t yPos, const uint16_t width, const uint16_t height) {
+  elements.push_back(TAG_PageImage);
+  serialization::writeSignedVarint(elements, xPos);
+  serialization::writeSignedVarint(elements, yPos);
+  serialization::writeVarint(elements, width);
+  serialization::writeVarint(elements, height);
+  serialization::writeVarint(elements, dictionary.indexOf(bmpPath));
+  serialization::writeVarint(elements, dictionary.indexOf(itemHref));
+  elementCount++;
 }
 
-void Page::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) const {
-  for (auto& element : elements) {
-    element->render(renderer, fontId, xOffset, yOffset);
+bool PageBuilder::serialize(FsFile& file) const {
+  const uint32_t wordCount = dictionary.offsets.size();
+  const uint32_t textStart = RECORD_HEADER_SIZE + wordCount * sizeof(uint16_t) + elements.size();
+  const uint32_t recordSize = textStart + dictionary.text.size();
+  if (recordSize > MAX_PAGE_RECORD_SIZE) {
+    Serial.printf("[%lu] [PGE] Serialization failed: Record size %u exceeds maximum\n", millis(), recordSize);
+    return false;
   }
+
+  // Header and word offset table, the offsets point at the words stored after the elements
+  std::vector<uint8_t> header;
+  header.reserve(RECORD_HEADER_SIZE + wordCount * sizeof(uint16_t));
+  appendU16(header, wordCount);
+  appendU16(header, elementCount);
+  for (const auto offset : dictionary.offsets) {
+    appendU16(header, textStart + offset);
+  }
+
+  serialization::writePod(file, recordSize);
+  return file.write(header.data(), header.size()) == header.size() &&
+         file.write(elements.data(), elements.size()) == elements.size() &&
+         file.write(reinterpret_cast<const uint8_t*>(dictionary.text.data()), dictionary.text.size()) ==
+             dictionary.text.size();
 }
 
-bool Page::serialize(FsFile& file) const {
-  const uint16_t count = elements.size();
-  serialization::writePod(file, count);
+template <typename WordVisitor, typename ImageVisitor>
+bool Page::forEachElement(WordVisitor&& visitWord, ImageVisitor&& visitImage) const {
+  const uint16_t wordCount = readU16(0);
+  const uint16_t elementCount = readU16(2);
+  const size_t elementsStart = RECORD_HEADER_SIZE + wordCount * sizeof(uint16_t);
+  serialization::BufferReader reader(record.data() + elementsStart, record.size() - elementsStart);
 
-  for (const auto& el : elements) {
-    // Only PageLine exists currently
-    serialization::writePod(file, static_cast<uint8_t>(TAG_PageLine));
-    if (!el->serialize(file)) {
+  for (uint16_t i = 0; i < elementCount && reader.ok; i++) {
+    const uint8_t tag = reader.readByte();
+    if (tag == TAG_PageImage) {
+      const int32_t imageX = reader.readSignedVarint();
+      const int32_t imageY = reader.readSignedVarint();
+      const uint32_t width = reader.readVarint();
+      const uint32_t height = reader.readVarint();
+      const uint32_t pathIndex = reader.readVarint();
+      const uint32_t hrefIndex = reader.readVarint();
+      if (!reader.ok || pathIndex >= wordCount || hrefIndex >= wordCount) {
+        Serial.printf("[%lu] [PGE] Bad image reference in element %u\n", millis(), i);
+        return false;
+      }
+      visitImage(imageX, imageY, width, height,
+                 reinterpret_cast<const char*>(record.data() + readU16(RECORD_HEADER_SIZE + pathIndex * 2)),
+                 reinterpret_cast<const char*>(record.data() + readU16(RECORD_HEADER_SIZE + hrefIndex * 2)));
+      continue;
+    }
+    if (tag != TAG_PageLine) {
+      Serial.printf("[%lu] [PGE] Unknown tag %u\n", millis(), tag);
       return false;
     }
+
+    const int32_t lineX = reader.readSignedVarint();
+    const int32_t lineY = reader.readSignedVarint();
+    const uint32_t lineWords = reader.readVarint();
+
+    // Style runs come first so they can be walked alongside the words
+    const uint32_t runCount = reader.readVarint();
+    serialization::BufferReader runs = reader;
+    for (uint32_t r = 0; r < runCount && reader.ok; r++) {
+      reader.readByte();
+      reader.readVarint();
+    }
+
+    auto style = EpdFontFamily::REGULAR;
+    uint32_t runLeft = 0;
+    int32_t x = 0;
+    for (uint32_t w = 0; w < lineWords && reader.ok; w++) {
+      if (runLeft == 0) {
+        style = static_cast<EpdFontFamily::Style>(runs.readByte());
+        runLeft = runs.readVarint();
+      }
+      runLeft--;
+
+      const uint32_t index = reader.readVarint();
+      x += reader.readSignedVarint();
+      if (index >= wordCount || !runs.ok) {
+        Serial.printf("[%lu] [PGE] Bad word reference in line %u\n", millis(), i);
+        return false;
+      }
+      visitWord(lineX + x, lineY,
+                reinterpret_cast<const char*>(record.data() + readU16(RECORD_HEADER_SIZE + index * 2)), style);
+    }
   }
 
-  return true;
+  return reader.ok;
 }
 
-std::unique_ptr<Page> Page::deserialize(FsFile& file) {
-  auto page = std::unique_ptr<Page>(new Page());
+void Page::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) const {
+  forEachElement(
+      [&](const int x, const int y, const char* word, const EpdFontFamily::Style style) {
+        renderer.drawText(fontId, x + xOffset, y + yOffset, word, true, style);
+      },
+      [&](const int x, const int y, const int width, const int height, const char* bmpPath, const char*) {
+        // Already dithered before the first render, each render pass only streams the rows it needs
+        FsFile file;
+        if (!SdMan.openFileForRead("PGE", bmpPath, file)) {
+          return;
+        }
+        Bitmap bitmap(file);
+        if (bitmap.parseHeaders() == BmpReaderError::Ok) {
+          renderer.drawBitmap(bitmap, x + xOffset, y + yOffset, width, height);
+        }
+        file.close();
+      });
+}
 
-  uint16_t count;
-  serialization::readPod(file, count);
+void Page::forEachImage(const std::function<void(const char* bmpPath, const char* itemHref)>& visit) const {
+  forEachElement([](int, int, const char*, EpdFontFamily::Style) {},
+                 [&](int, int, int, int, const char* bmpPath, const char* itemHref) { visit(bmpPath, itemHref); });
+}
 
-  for (uint16_t i = 0; i < count; i++) {
-    uint8_t tag;
-    serialization::readPod(file, tag);
+std::unique_ptr<Page> Page::deserialize(FsFile& file) {
+  uint32_t recordSize;
+  serialization::readPod(file, recordSize);
+  if (recordSize < RECORD_HEADER_SIZE || recordSize > MAX_PAGE_RECORD_SIZE) {
+    Serial.printf("[%lu] [PGE] Deserialization failed: Bad record size %u\n", millis(), recordSize);
+    return nullptr;
+  }
+
+  auto page = std::unique_ptr<Page>(new Page());
+  page->record.resize(recordSize);
+  if (file.read(page->record.data(), recordSize) != static_cast<int>(recordSize)) {
+    Serial.printf("[%lu] [PGE] Deserialization failed: Short read\n", millis());
+    return nullptr;
+  }
 
-    if (tag == TAG_PageLine) {
-      auto pl = PageLine::deserialize(file);
-      page->elements.push_back(std::move(pl));
-    } else {
-      Serial.printf("[%lu] [PGE] Deserialization failed: Unknown tag %u\n", millis(), tag);
+  // Validate once here so rendering can draw words straight out of the buffer
+  const uint16_t wordCount = page->readU16(0);
+  if (RECORD_HEADER_SIZE + wordCount * sizeof(uint16_t) > recordSize ||
+      (wordCount > 0 && page->record.back() != '\0')) {
+    Serial.printf("[%lu] [PGE] Deserialization failed: Bad word table\n", millis());
+    return nullptr;
+  }
+  for (uint16_t i = 0; i < wordCount; i++) {
+    if (page->readU16(RECORD_HEADER_SIZE + i * 2) >= recordSize) {
+      Serial.printf("[%lu] [PGE] Deserialization failed: Bad word offset\n", millis());
       return nullptr;
     }
   }
+  if (!page->forEachElement([](int, int, const char*, EpdFontFamily::Style) {},
+                            [](int, int, int, int, const char*, const char*) {})) {
+    Serial.printf("[%lu] [PGE] Deserialization failed: Truncated record\n", millis());
+    return nullptr;
+  }
 
   return page;
 }
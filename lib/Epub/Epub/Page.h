@@ -1,43 +1,44 @@
 #pragma once
 #include <SdFat.h>
 
-#include <utility>
+#include <functional>
+#include <memory>
 #include <vector>
 
 #include "blocks/TextBlock.h"
 
 enum PageElementTag : uint8_t {
   TAG_PageLine = 1,
+  TAG_PageImage = 2,
 };
 
-// represents something that has been added to a page
-class PageElement {
- public:
-  int16_t xPos;
-  int16_t yPos;
-  explicit PageElement(const int16_t xPos, const int16_t yPos) : xPos(xPos), yPos(yPos) {}
-  virtual ~PageElement() = default;
-  virtual void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) = 0;
-  virtual bool serialize(FsFile& file) = 0;
-};
-
-// a line from a block element
-class PageLine final : public PageElement {
-  std::shared_ptr<TextBlock> block;
+// Collects the lines and images of a page while it is being laid out and writes them as one page record
+class PageBuilder {
+  WordDictionary dictionary;
+  std::vector<uint8_t> elements;
+  uint16_t elementCount = 0;
 
  public:
-  PageLine(std::shared_ptr<TextBlock> block, const int16_t xPos, const int16_t yPos)
-      : PageElement(xPos, yPos), block(std::move(block)) {}
-  void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) override;
-  bool serialize(FsFile& file) override;
-  static std::unique_ptr<PageLine> deserialize(FsFile& file);
+  void addLine(const TextBlock& line, int16_t xPos, int16_t yPos);
+  // The image itself stays in its cached BMP, the page only keeps the path and the item it is made from next to its
+  // words
+  void addImage(const std::string& bmpPath, const std::string& itemHref, int16_t xPos, int16_t yPos, uint16_t width,
+                uint16_t height);
+  // Writes the page as one length prefixed record so it can be read back with a single read
+  bool serialize(FsFile& file) const;
 };
 
+// A laid out page, kept as the flat record it was stored as: a word offset table, the varint coded lines and images
+// and the NUL terminated words and image paths all live in one buffer and are drawn straight from it
 class Page {
+  std::vector<uint8_t> record;
+
+  uint16_t readU16(size_t offset) const { return record[offset] | (record[offset + 1] << 8); }
+  template <typename WordVisitor, typename ImageVisitor>
+  bool forEachElement(WordVisitor&& visitWord, ImageVisitor&& visitImage) const;
+
  public:
-  // the list of block index and line numbers on this page
-  std::vector<std::shared_ptr<PageElement>> elements;
   void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) const;
-  bool serialize(FsFile& file) const;
+  void forEachImage(const std::function<void(const char* bmpPath, const char* itemHref)>& visit) const;
   static std::unique_ptr<Page> deserialize(FsFile& file);
 };
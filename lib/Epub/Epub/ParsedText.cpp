@@ -2,67 +2,65 @@
 
 #include <GfxRenderer.h>
 
-#include <algorithm>
-#include <cmath>
-#include <functional>
 #include <limits>
+#include <list>
 #include <vector>
 
+namespace {
 constexpr int MAX_COST = std::numeric_limits<int>::max();
-
-void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle) {
-  if (word.empty()) return;
-
-  words.push_back(std::move(word));
-  wordStyles.push_back(fontStyle);
-}
-
-// Consumes data to minimize memory usage
-void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fontId, const uint16_t viewportWidth,
-                                       const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
-                                       const bool includeLastLine) {
-  if (words.empty()) {
-    return;
+// Lines worth of words buffered behind the line being committed. Breaks are chosen optimally over this window, which
+// in practice matches breaking the whole paragraph at once
+constexpr int LOOKAHEAD_LINES = 24;
+}  // namespace
+
+ParsedText::ParsedText(const TextBlock::Style style, const bool extraParagraphSpacing, const GfxRenderer& renderer,
+                       const int fontId, const uint16_t viewportWidth,
+                       const std::function<void(std::shared_ptr<TextBlock>)>& processLine)
+    : style(style),
+      extraParagraphSpacing(extraParagraphSpacing),
+      font(renderer.getFontFamily(fontId)),
+      pageWidth(viewportWidth),
+      spaceWidth(renderer.getSpaceWidth(fontId)),
+      processLine(processLine) {}
+
+void ParsedText::addWord(const char* word, const EpdFontFamily::Style fontStyle) {
+  if (*word == '\0') return;
+
+  const uint32_t offset = arena.size();
+  // add em-space at the beginning of first word in paragraph to indent
+  if (!hasContent && !extraParagraphSpacing) {
+    arena.append("\xe2\x80\x83");
   }
-
-  const int pageWidth = viewportWidth;
-  const int spaceWidth = renderer.getSpaceWidth(fontId);
-  const auto wordWidths = calculateWordWidths(renderer, fontId);
-  const auto lineBreakIndices = computeLineBreaks(pageWidth, spaceWidth, wordWidths);
-  const size_t lineCount = includeLastLine ? lineBreakIndices.size() : lineBreakIndices.size() - 1;
-
-  for (size_t i = 0; i < lineCount; ++i) {
-    extractLine(i, pageWidth, spaceWidth, wordWidths, lineBreakIndices, processLine);
+  arena.append(word);
+  const uint16_t length = arena.size() - offset;
+  arena.push_back('\0');
+
+  const uint16_t width = font ? font->getTextWidth(arena.c_str() + offset, fontStyle) : 0;
+  words.push_back({offset, length, width, fontStyle});
+  hasContent = true;
+  bufferedWidth += width + spaceWidth;
+
+  // Commit the first line once there is enough text behind it that later words practically never move its break
+  while (bufferedWidth > LOOKAHEAD_LINES * pageWidth) {
+    const auto lineBreaks = computeLineBreaks();
+    extractLine(lineBreaks.front(), false);
   }
 }
 
-std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& renderer, const int fontId) {
-  const size_t totalWordCount = words.size();
-
-  std::vector<uint16_t> wordWidths;
-  wordWidths.reserve(totalWordCount);
-
-  // add em-space at the beginning of first word in paragraph to indent
-  if (!extraParagraphSpacing) {
-    std::string& first_word = words.front();
-    first_word.insert(0, "\xe2\x80\x83");
+void ParsedText::layoutAndExtractLines() {
+  if (words.empty()) {
+    return;
   }
 
-  auto wordsIt = words.begin();
-  auto wordStylesIt = wordStyles.begin();
-
-  while (wordsIt != words.end()) {
-    wordWidths.push_back(renderer.getTextWidth(fontId, wordsIt->c_str(), *wordStylesIt));
-
-    std::advance(wordsIt, 1);
-    std::advance(wordStylesIt, 1);
+  const auto lineBreakIndices = computeLineBreaks();
+  size_t lastBreakAt = 0;
+  for (size_t i = 0; i < lineBreakIndices.size(); ++i) {
+    extractLine(lineBreakIndices[i] - lastBreakAt, i == lineBreakIndices.size() - 1);
+    lastBreakAt = lineBreakIndices[i];
   }
-
-  return wordWidths;
 }
 
-std::vector<size_t> ParsedText::computeLineBreaks(const int pageWidth, const int spaceWidth,
-                                                  const std::vector<uint16_t>& wordWidths) const {
+std::vector<size_t> ParsedText::computeLineBreaks() const {
   const size_t totalWordCount = words.size();
 
   // DP table to store the minimum badness (cost) of lines starting at index i
@@ -80,7 +78,7 @@ std::vector<size_t> ParsedText::computeLineBreaks(const int pageWidth, const int
 
     for (size_t j = i; j < totalWordCount; ++j) {
       // Current line length: previous width + space + current word width
-      currlen += wordWidths[j] + spaceWidth;
+      currlen += words[j].width + spaceWidth;
 
       if (currlen > pageWidth) {
         break;
@@ -140,24 +138,18 @@ std::vector<size_t> ParsedText::computeLineBreaks(const int pageWidth, const int
   return lineBreakIndices;
 }
 
-void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const int spaceWidth,
-                             const std::vector<uint16_t>& wordWidths, const std::vector<size_t>& lineBreakIndices,
-                             const std::function<void(std::shared_ptr<TextBlock>)>& processLine) {
-  const size_t lineBreak = lineBreakIndices[breakIndex];
-  const size_t lastBreakAt = breakIndex > 0 ? lineBreakIndices[breakIndex - 1] : 0;
-  const size_t lineWordCount = lineBreak - lastBreakAt;
-
+// Emits the first lineWordCount buffered words as a line and drops them from the buffer
+void ParsedText::extractLine(const size_t lineWordCount, const bool isLastLine) {
   // Calculate total word width for this line
   int lineWordWidthSum = 0;
-  for (size_t i = lastBreakAt; i < lineBreak; i++) {
-    lineWordWidthSum += wordWidths[i];
+  for (size_t i = 0; i < lineWordCount; i++) {
+    lineWordWidthSum += words[i].width;
   }
 
   // Calculate spacing
   const int spareSpace = pageWidth - lineWordWidthSum;
 
   int spacing = spaceWidth;
-  const bool isLastLine = breakIndex == lineBreakIndices.size() - 1;
 
   if (style == TextBlock::JUSTIFIED && !isLastLine && lineWordCount >= 2) {
     spacing = spareSpace / (lineWordCount - 1);
@@ -171,25 +163,30 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
     xpos = (spareSpace - (lineWordCount - 1) * spaceWidth) / 2;
   }
 
-  // Pre-calculate X positions for words
+  std::list<std::string> lineWords;
   std::list<uint16_t> lineXPos;
-  for (size_t i = lastBreakAt; i < lineBreak; i++) {
-    const uint16_t currentWordWidth = wordWidths[i];
+  std::list<EpdFontFamily::Style> lineWordStyles;
+  for (size_t i = 0; i < lineWordCount; i++) {
+    const Word& word = words[i];
+    lineWords.emplace_back(arena, word.offset, word.length);
     lineXPos.push_back(xpos);
-    xpos += currentWordWidth + spacing;
+    lineWordStyles.push_back(word.style);
+    xpos += word.width + spacing;
+    bufferedWidth -= word.width + spaceWidth;
   }
 
-  // Iterators always start at the beginning as we are moving content with splice below
-  auto wordEndIt = words.begin();
-  auto wordStyleEndIt = wordStyles.begin();
-  std::advance(wordEndIt, lineWordCount);
-  std::advance(wordStyleEndIt, lineWordCount);
-
-  // *** CRITICAL STEP: CONSUME DATA USING SPLICE ***
-  std::list<std::string> lineWords;
-  lineWords.splice(lineWords.begin(), words, words.begin(), wordEndIt);
-  std::list<EpdFontFamily::Style> lineWordStyles;
-  lineWordStyles.splice(lineWordStyles.begin(), wordStyles, wordStyles.begin(), wordStyleEndIt);
+  // Consume the line's words, the arena only ever holds the buffered window
+  if (lineWordCount < words.size()) {
+    const uint32_t consumed = words[lineWordCount].offset;
+    arena.erase(0, consumed);
+    words.erase(words.begin(), words.begin() + lineWordCount);
+    for (auto& word : words) {
+      word.offset -= consumed;
+    }
+  } else {
+    arena.clear();
+    words.clear();
+  }
 
   processLine(std::make_shared<TextBlock>(std::move(lineWords), std::move(lineXPos), std::move(lineWordStyles), style));
 }
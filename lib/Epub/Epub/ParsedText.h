@@ -3,7 +3,6 @@
 #include <EpdFontFamily.h>
 
 #include <functional>
-#include <list>
 #include <memory>
 #include <string>
 #include <vector>
@@ -12,29 +11,41 @@
 
 class GfxRenderer;
 
+// Lays out a paragraph as its words arrive. Lines are emitted as soon as enough words are buffered behind them, so
+// memory stays bounded however long the paragraph is
 class ParsedText {
-  std::list<std::string> words;
-  std::list<EpdFontFamily::Style> wordStyles;
+  // A buffered word, its text is stored NUL terminated in the arena
+  struct Word {
+    uint32_t offset;
+    uint16_t length;
+    uint16_t width;
+    EpdFontFamily::Style style;
+  };
+
+  std::string arena;
+  std::vector<Word> words;
   TextBlock::Style style;
   bool extraParagraphSpacing;
+  bool hasContent = false;
+  // Resolved once per paragraph, every word is measured against it
+  const EpdFontFamily* font;
+  int pageWidth;
+  int spaceWidth;
+  int bufferedWidth = 0;
+  std::function<void(std::shared_ptr<TextBlock>)> processLine;
 
-  std::vector<size_t> computeLineBreaks(int pageWidth, int spaceWidth, const std::vector<uint16_t>& wordWidths) const;
-  void extractLine(size_t breakIndex, int pageWidth, int spaceWidth, const std::vector<uint16_t>& wordWidths,
-                   const std::vector<size_t>& lineBreakIndices,
-                   const std::function<void(std::shared_ptr<TextBlock>)>& processLine);
-  std::vector<uint16_t> calculateWordWidths(const GfxRenderer& renderer, int fontId);
+  std::vector<size_t> computeLineBreaks() const;
+  void extractLine(size_t lineWordCount, bool isLastLine);
 
  public:
-  explicit ParsedText(const TextBlock::Style style, const bool extraParagraphSpacing)
-      : style(style), extraParagraphSpacing(extraParagraphSpacing) {}
+  explicit ParsedText(TextBlock::Style style, bool extraParagraphSpacing, const GfxRenderer& renderer, int fontId,
+                      uint16_t viewportWidth, const std::function<void(std::shared_ptr<TextBlock>)>& processLine);
   ~ParsedText() = default;
 
-  void addWord(std::string word, EpdFontFamily::Style fontStyle);
+  void addWord(const char* word, EpdFontFamily::Style fontStyle);
   void setStyle(const TextBlock::Style style) { this->style = style; }
   TextBlock::Style getStyle() const { return style; }
-  size_t size() const { return words.size(); }
-  bool isEmpty() const { return words.empty(); }
-  void layoutAndExtractLines(const GfxRenderer& renderer, int fontId, uint16_t viewportWidth,
-                             const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
-                             bool includeLastLine = true);
+  bool isEmpty() const { return !hasContent; }
+  // Lays out and emits the remaining lines, the paragraph is complete
+  void layoutAndExtractLines();
 };
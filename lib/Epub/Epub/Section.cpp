@@ -1,18 +1,22 @@
 #include "Section.h"
 
+#include <FsHelpers.h>
+#include <GfxRenderer.h>
 #include <SDCardManager.h>
 #include <Serialization.h>
 
+#include <cstring>
+
 #include "Page.h"
 #include "parsers/ChapterHtmlSlimParser.h"
 
 namespace {
-constexpr uint8_t SECTION_FILE_VERSION = 9;
+constexpr uint8_t SECTION_FILE_VERSION = 13;
 constexpr uint32_t HEADER_SIZE = sizeof(uint8_t) + sizeof(int) + sizeof(float) + sizeof(bool) + sizeof(uint8_t) +
                                  sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint32_t);
 }  // namespace
 
-uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
+uint32_t Section::onPageComplete(std::unique_ptr<PageBuilder> page) {
   if (!file) {
     Serial.printf("[%lu] [SCT] File not open for writing page %d\n", millis(), pageCount);
     return 0;
@@ -91,8 +95,20 @@ bool Section::loadSectionFile(const int fontId, const float lineCompression, con
     }
   }
 
+  // The LUT offset is written as 0 and only filled in once the build finishes, a file left behind by an interrupted
+  // build still has it that way. A page count of 0 is a finished empty chapter
+  uint32_t lutOffset;
   serialization::readPod(file, pageCount);
+  serialization::readPod(file, lutOffset);
   file.close();
+  if (lutOffset == 0) {
+    Serial.printf("[%lu] [SCT] Deserialization failed: Incomplete section file\n", millis());
+    pageCount = 0;
+    clearCache();
+    return false;
+  }
+  imageMaxWidth = viewportWidth;
+  imageMaxHeight = viewportHeight;
   Serial.printf("[%lu] [SCT] Deserialization succeeded: %d pages\n", millis(), pageCount);
   return true;
 }
@@ -113,13 +129,44 @@ bool Section::clearCache() const {
   return true;
 }
 
+bool Section::measureImage(const std::string& chapterHref, const char* src, const uint16_t maxWidth,
+                           const uint16_t maxHeight, std::string& itemHref, std::string& bmpPath, int* width,
+                           int* height) const {
+  // Sources are relative to the chapter, inline data and remote images are not supported
+  if (strchr(src, ':') != nullptr) {
+    return false;
+  }
+
+  itemHref = FsHelpers::normalisePath(chapterHref.substr(0, chapterHref.find_last_of('/') + 1) + src);
+  bmpPath = epub->getImageBmpPath(itemHref, maxWidth, maxHeight);
+
+  // Decoding is left to the first render of the page, the layout only needs the size
+  FsFile bmpFile;
+  if (!SdMan.exists(bmpPath.c_str()) || !SdMan.openFileForRead("SCT", bmpPath, bmpFile)) {
+    return epub->getImageSize(itemHref, maxWidth, maxHeight, width, height);
+  }
+  Bitmap bitmap(bmpFile);
+  const bool success = bitmap.parseHeaders() == BmpReaderError::Ok;
+  *width = bitmap.getWidth();
+  *height = bitmap.getHeight();
+  bmpFile.close();
+  return success;
+}
+
+void Section::generatePageImages(const Page& page) const {
+  page.forEachImage([this](const char*, const char* itemHref) {
+    // Only does any work the first time, after that the BMP is found in the cache
+    epub->generateImageBmp(itemHref, imageMaxWidth, imageMaxHeight);
+  });
+}
+
 bool Section::createSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                                 const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                                 const uint16_t viewportHeight, const std::function<void()>& progressSetupFn,
-                                const std::function<void(int)>& progressFn) {
+                                const std::function<void(int)>& progressFn,
+                                const std::function<bool()>& yieldFn) {
   constexpr uint32_t MIN_SIZE_FOR_PROGRESS = 50 * 1024;  // 50KB
   const auto localPath = epub->getSpineItem(spineIndex).href;
-  const auto tmpHtmlPath = epub->getCachePath() + "/.tmp_" + std::to_string(spineIndex) + ".html";
 
   // Create cache directory if it doesn't exist
   {
@@ -128,43 +175,24 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
   }
 
   // Retry logic for SD card timing issues
+  // The entry is inflated straight into the parser, so only opening it needs retrying
+  ZipFile::EntryReader reader;
   bool success = false;
-  uint32_t fileSize = 0;
   for (int attempt = 0; attempt < 3 && !success; attempt++) {
     if (attempt > 0) {
-      Serial.printf("[%lu] [SCT] Retrying stream (attempt %d)...\n", millis(), attempt + 1);
+      Serial.printf("[%lu] [SCT] Retrying open (attempt %d)...\n", millis(), attempt + 1);
       delay(50);  // Brief delay before retry
     }
-
-    // Remove any incomplete file from previous attempt before retrying
-    if (SdMan.exists(tmpHtmlPath.c_str())) {
-      SdMan.remove(tmpHtmlPath.c_str());
-    }
-
-    FsFile tmpHtml;
-    if (!SdMan.openFileForWrite("SCT", tmpHtmlPath, tmpHtml)) {
-      continue;
-    }
-    success = epub->readItemContentsToStream(localPath, tmpHtml, 1024);
-    fileSize = tmpHtml.size();
-    tmpHtml.close();
-
-    // If streaming failed, remove the incomplete file immediately
-    if (!success && SdMan.exists(tmpHtmlPath.c_str())) {
-      SdMan.remove(tmpHtmlPath.c_str());
-      Serial.printf("[%lu] [SCT] Removed incomplete temp file after failed attempt\n", millis());
-    }
+    success = epub->openItemReader(localPath, reader, 1024);
   }
 
   if (!success) {
-    Serial.printf("[%lu] [SCT] Failed to stream item contents to temp file after retries\n", millis());
+    Serial.printf("[%lu] [SCT] Failed to open item contents after retries\n", millis());
     return false;
   }
 
-  Serial.printf("[%lu] [SCT] Streamed temp HTML to %s (%d bytes)\n", millis(), tmpHtmlPath.c_str(), fileSize);
-
   // Only show progress bar for larger chapters where rendering overhead is worth it
-  if (progressSetupFn && fileSize >= MIN_SIZE_FOR_PROGRESS) {
+  if (progressSetupFn && reader.size() >= MIN_SIZE_FOR_PROGRESS) {
     progressSetupFn();
   }
 
@@ -173,20 +201,29 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
   }
   writeSectionFileHeader(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
                          viewportHeight);
-  std::vector<uint32_t> lut = {};
+  lut.clear();
+  imageMaxWidth = viewportWidth;
+  imageMaxHeight = viewportHeight;
+  buildInProgress = true;
 
   ChapterHtmlSlimParser visitor(
-      tmpHtmlPath, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+      reader, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
       viewportHeight,
-      [this, &lut](std::unique_ptr<Page> page) { lut.emplace_back(this->onPageComplete(std::move(page))); },
-      progressFn);
+      [this](std::unique_ptr<PageBuilder> page) { lut.emplace_back(this->onPageComplete(std::move(page))); },
+      progressFn, yieldFn,
+      [&](const char* src, std::string& itemHref, std::string& bmpPath, int* width, int* height) {
+        return measureImage(localPath, src, viewportWidth, viewportHeight, itemHref, bmpPath, width, height);
+      });
   success = visitor.parseAndBuildPages();
 
-  SdMan.remove(tmpHtmlPath.c_str());
+  reader.close();
+  buildInProgress = false;
   if (!success) {
     Serial.printf("[%lu] [SCT] Failed to parse XML and build pages\n", millis());
     file.close();
     SdMan.remove(filePath.c_str());
+    lut.clear();
+    pageCount = 0;
     return false;
   }
 
@@ -201,10 +238,14 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
     serialization::writePod(file, pos);
   }
 
+  lut.clear();
+  lut.shrink_to_fit();
+
   if (hasFailedLutRecords) {
     Serial.printf("[%lu] [SCT] Failed to write LUT due to invalid page positions\n", millis());
     file.close();
     SdMan.remove(filePath.c_str());
+    pageCount = 0;
     return false;
   }
 
@@ -217,6 +258,10 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
 }
 
 std::unique_ptr<Page> Section::loadPageFromSectionFile() {
+  if (buildInProgress) {
+    return loadBuiltPage();
+  }
+
   if (!SdMan.openFileForRead("SCT", filePath, file)) {
     return nullptr;
   }
@@ -233,3 +278,20 @@ std::unique_ptr<Page> Section::loadPageFromSectionFile() {
   file.close();
   return page;
 }
+
+std::unique_ptr<Page> Section::loadBuiltPage() {
+  if (currentPage < 0 || currentPage >= static_cast<int>(lut.size()) || lut[currentPage] == 0) {
+    return nullptr;
+  }
+
+  // Commit what has been appended so far so a second handle sees it, the write handle stays at the end of the file
+  file.flush();
+  FsFile pageFile;
+  if (!SdMan.openFileForRead("SCT", filePath, pageFile)) {
+    return nullptr;
+  }
+  pageFile.seek(lut[currentPage]);
+  auto page = Page::deserialize(pageFile);
+  pageFile.close();
+  return page;
+}
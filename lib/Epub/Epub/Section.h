@@ -1,10 +1,12 @@
 #pragma once
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "Epub.h"
 
 class Page;
+class PageBuilder;
 class GfxRenderer;
 
 class Section {
@@ -13,14 +15,24 @@ class Section {
   GfxRenderer& renderer;
   std::string filePath;
   FsFile file;
+  // Page offsets of the section being built, pages can be read back from here before the LUT is written
+  std::vector<uint32_t> lut;
+  // Images are scaled to fit the viewport the section was laid out for
+  uint16_t imageMaxWidth = 0;
+  uint16_t imageMaxHeight = 0;
 
   void writeSectionFileHeader(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                               uint16_t viewportWidth, uint16_t viewportHeight);
-  uint32_t onPageComplete(std::unique_ptr<Page> page);
+  uint32_t onPageComplete(std::unique_ptr<PageBuilder> page);
+  std::unique_ptr<Page> loadBuiltPage();
+  bool measureImage(const std::string& chapterHref, const char* src, uint16_t maxWidth, uint16_t maxHeight,
+                    std::string& itemHref, std::string& bmpPath, int* width, int* height) const;
 
  public:
   uint16_t pageCount = 0;
   int currentPage = 0;
+  // Set while createSectionFile is still appending pages, pageCount is provisional until it clears
+  bool buildInProgress = false;
 
   explicit Section(const std::shared_ptr<Epub>& epub, const int spineIndex, GfxRenderer& renderer)
       : epub(epub),
@@ -34,6 +46,10 @@ class Section {
   bool createSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                          uint16_t viewportWidth, uint16_t viewportHeight,
                          const std::function<void()>& progressSetupFn = nullptr,
-                         const std::function<void(int)>& progressFn = nullptr);
+                         const std::function<void(int)>& progressFn = nullptr,
+                         const std::function<bool()>& yieldFn = nullptr);
   std::unique_ptr<Page> loadPageFromSectionFile();
+  // Converts the images of a page that have not been drawn before, kept out of the build so a background layout
+  // never holds up page turns with a JPEG decode
+  void generatePageImages(const Page& page) const;
 };
@@ -1,13 +1,37 @@
 #pragma once
 #include <EpdFontFamily.h>
-#include <SdFat.h>
+#include <Serialization.h>
 
 #include <list>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "Block.h"
 
+// Distinct words of one page record, lines refer to them by index so a repeated word is only stored once per page
+class WordDictionary {
+  std::unordered_map<std::string, uint16_t> lookup;
+
+ public:
+  // Words in index order, each NUL terminated so they can be drawn straight out of the page record
+  std::string text;
+  std::vector<uint16_t> offsets;
+
+  uint32_t indexOf(const std::string& word) {
+    const auto it = lookup.find(word);
+    if (it != lookup.end()) {
+      return it->second;
+    }
+    const uint16_t index = offsets.size();
+    offsets.push_back(text.size());
+    text.append(word).push_back('\0');
+    lookup.emplace(word, index);
+    return index;
+  }
+};
+
 // Represents a line of text on a page
 class TextBlock final : public Block {
  public:
@@ -33,9 +57,7 @@ class TextBlock final : public Block {
   Style getStyle() const { return style; }
   bool isEmpty() override { return words.empty(); }
   void layout(GfxRenderer& renderer) override {};
-  // given a renderer works out where to break the words into lines
-  void render(const GfxRenderer& renderer, int fontId, int x, int y) const;
   BlockType getType() override { return TEXT_BLOCK; }
-  bool serialize(FsFile& file) const;
-  static std::unique_ptr<TextBlock> deserialize(FsFile& file);
+  // Appends the line in the page record encoding, see Page
+  bool serialize(std::vector<uint8_t>& out, WordDictionary& dictionary) const;
 };
@@ -2,7 +2,6 @@
 
 #include <GfxRenderer.h>
 #include <HardwareSerial.h>
-#include <SDCardManager.h>
 #include <expat.h>
 
 #include "../Page.h"
@@ -51,7 +50,30 @@ void ChapterHtmlSlimParser::startNewTextBlock(const TextBlock::Style style) {
 
     makePages();
   }
-  currentTextBlock.reset(new ParsedText(style, extraParagraphSpacing));
+  currentTextBlock.reset(new ParsedText(style, extraParagraphSpacing, renderer, fontId, viewportWidth,
+                                        [this](const std::shared_ptr<TextBlock>& line) { addLineToPage(line); }));
+}
+
+EpdFontFamily::Style ChapterHtmlSlimParser::currentFontStyle() const {
+  if (boldUntilDepth < depth && italicUntilDepth < depth) {
+    return EpdFontFamily::BOLD_ITALIC;
+  }
+  if (boldUntilDepth < depth) {
+    return EpdFontFamily::BOLD;
+  }
+  if (italicUntilDepth < depth) {
+    return EpdFontFamily::ITALIC;
+  }
+  return EpdFontFamily::REGULAR;
+}
+
+void ChapterHtmlSlimParser::flushPartWord(const EpdFontFamily::Style style) {
+  if (partWordBufferIndex == 0) {
+    return;
+  }
+  partWordBuffer[partWordBufferIndex] = '\0';
+  currentTextBlock->addWord(partWordBuffer, style);
+  partWordBufferIndex = 0;
 }
 
 void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char* name, const XML_Char** atts) {
@@ -64,7 +86,14 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
   }
 
   if (matches(name, IMAGE_TAGS, NUM_IMAGE_TAGS)) {
-    // TODO: Start processing image tags
+    if (atts != nullptr && self->imageFn) {
+      for (int i = 0; atts[i]; i += 2) {
+        if (strcmp(atts[i], "src") == 0) {
+          self->addImageToPage(atts[i + 1]);
+          break;
+        }
+      }
+    }
     self->skipUntilDepth = self->depth;
     self->depth += 1;
     return;
@@ -115,23 +144,12 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
     return;
   }
 
-  EpdFontFamily::Style fontStyle = EpdFontFamily::REGULAR;
-  if (self->boldUntilDepth < self->depth && self->italicUntilDepth < self->depth) {
-    fontStyle = EpdFontFamily::BOLD_ITALIC;
-  } else if (self->boldUntilDepth < self->depth) {
-    fontStyle = EpdFontFamily::BOLD;
-  } else if (self->italicUntilDepth < self->depth) {
-    fontStyle = EpdFontFamily::ITALIC;
-  }
+  const EpdFontFamily::Style fontStyle = self->currentFontStyle();
 
   for (int i = 0; i < len; i++) {
     if (isWhitespace(s[i])) {
       // Currently looking at whitespace, if there's anything in the partWordBuffer, flush it
-      if (self->partWordBufferIndex > 0) {
-        self->partWordBuffer[self->partWordBufferIndex] = '\0';
-        self->currentTextBlock->addWord(self->partWordBuffer, fontStyle);
-        self->partWordBufferIndex = 0;
-      }
+      self->flushPartWord(fontStyle);
       // Skip the whitespace char
       continue;
     }
@@ -153,24 +171,11 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
 
     // If we're about to run out of space, then cut the word off and start a new one
     if (self->partWordBufferIndex >= MAX_WORD_SIZE) {
-      self->partWordBuffer[self->partWordBufferIndex] = '\0';
-      self->currentTextBlock->addWord(self->partWordBuffer, fontStyle);
-      self->partWordBufferIndex = 0;
+      self->flushPartWord(fontStyle);
     }
 
     self->partWordBuffer[self->partWordBufferIndex++] = s[i];
   }
-
-  // If we have > 750 words buffered up, perform the layout and consume out all but the last line
-  // There should be enough here to build out 1-2 full pages and doing this will free up a lot of
-  // memory.
-  // Spotted when reading Intermezzo, there are some really long text blocks in there.
-  if (self->currentTextBlock->size() > 750) {
-    Serial.printf("[%lu] [EHP] Text block too long, splitting into multiple pages\n", millis());
-    self->currentTextBlock->layoutAndExtractLines(
-        self->renderer, self->fontId, self->viewportWidth,
-        [self](const std::shared_ptr<TextBlock>& textBlock) { self->addLineToPage(textBlock); }, false);
-  }
 }
 
 void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* name) {
@@ -186,18 +191,7 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* n
         matches(name, BOLD_TAGS, NUM_BOLD_TAGS) || matches(name, ITALIC_TAGS, NUM_ITALIC_TAGS) || self->depth == 1;
 
     if (shouldBreakText) {
-      EpdFontFamily::Style fontStyle = EpdFontFamily::REGULAR;
-      if (self->boldUntilDepth < self->depth && self->italicUntilDepth < self->depth) {
-        fontStyle = EpdFontFamily::BOLD_ITALIC;
-      } else if (self->boldUntilDepth < self->depth) {
-        fontStyle = EpdFontFamily::BOLD;
-      } else if (self->italicUntilDepth < self->depth) {
-        fontStyle = EpdFontFamily::ITALIC;
-      }
-
-      self->partWordBuffer[self->partWordBufferIndex] = '\0';
-      self->currentTextBlock->addWord(self->partWordBuffer, fontStyle);
-      self->partWordBufferIndex = 0;
+      self->flushPartWord(self->currentFontStyle());
     }
   }
 
@@ -230,14 +224,8 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
     return false;
   }
 
-  FsFile file;
-  if (!SdMan.openFileForRead("EHP", filepath, file)) {
-    XML_ParserFree(parser);
-    return false;
-  }
-
-  // Get file size for progress calculation
-  const size_t totalSize = file.size();
+  // Inflated size of the entry for progress calculation
+  const size_t totalSize = source.size();
   size_t bytesRead = 0;
   int lastProgress = -1;
 
@@ -246,6 +234,15 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
   XML_SetCharacterDataHandler(parser, characterData);
 
   do {
+    if (yieldFn && !yieldFn()) {
+      Serial.printf("[%lu] [EHP] Build cancelled\n", millis());
+      XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
+      XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
+      XML_SetCharacterDataHandler(parser, nullptr);
+      XML_ParserFree(parser);
+      return false;
+    }
+
     void* const buf = XML_GetBuffer(parser, 1024);
     if (!buf) {
       Serial.printf("[%lu] [EHP] Couldn't allocate memory for buffer\n", millis());
@@ -253,19 +250,17 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
       XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
       XML_SetCharacterDataHandler(parser, nullptr);
       XML_ParserFree(parser);
-      file.close();
       return false;
     }
 
-    const size_t len = file.read(buf, 1024);
+    const size_t len = source.read(static_cast<uint8_t*>(buf), 1024);
 
-    if (len == 0 && file.available() > 0) {
-      Serial.printf("[%lu] [EHP] File read error\n", millis());
+    if (len == 0 && (source.available() || source.hasFailed())) {
+      Serial.printf("[%lu] [EHP] Entry read error\n", millis());
       XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
       XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
       XML_SetCharacterDataHandler(parser, nullptr);
       XML_ParserFree(parser);
-      file.close();
       return false;
     }
 
@@ -280,7 +275,7 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
       }
     }
 
-    done = file.available() == 0;
+    done = !source.available();
 
     if (XML_ParseBuffer(parser, static_cast<int>(len), done) == XML_STATUS_ERROR) {
       Serial.printf("[%lu] [EHP] Parse error at line %lu:\n%s\n", millis(), XML_GetCurrentLineNumber(parser),
@@ -289,7 +284,6 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
       XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
       XML_SetCharacterDataHandler(parser, nullptr);
       XML_ParserFree(parser);
-      file.close();
       return false;
     }
   } while (!done);
@@ -298,7 +292,6 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
   XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
   XML_SetCharacterDataHandler(parser, nullptr);
   XML_ParserFree(parser);
-  file.close();
 
   // Process last page if there is still text
   if (currentTextBlock) {
@@ -314,16 +307,51 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
 void ChapterHtmlSlimParser::addLineToPage(std::shared_ptr<TextBlock> line) {
   const int lineHeight = renderer.getLineHeight(fontId) * lineCompression;
 
+  // Long paragraphs emit lines while they are still being parsed, possibly before makePages has run
+  if (!currentPage) {
+    currentPage.reset(new PageBuilder());
+    currentPageNextY = 0;
+  }
+
   if (currentPageNextY + lineHeight > viewportHeight) {
     completePageFn(std::move(currentPage));
-    currentPage.reset(new Page());
+    currentPage.reset(new PageBuilder());
     currentPageNextY = 0;
   }
 
-  currentPage->elements.push_back(std::make_shared<PageLine>(line, 0, currentPageNextY));
+  currentPage->addLine(*line, 0, currentPageNextY);
   currentPageNextY += lineHeight;
 }
 
+void ChapterHtmlSlimParser::addImageToPage(const char* src) {
+  std::string itemHref;
+  std::string bmpPath;
+  int width;
+  int height;
+  if (!imageFn(src, itemHref, bmpPath, &width, &height)) {
+    return;
+  }
+
+  // Text in front of the image is laid out above it, whatever follows continues in a new block below it
+  flushPartWord(currentFontStyle());
+  startNewTextBlock(currentTextBlock->getStyle());
+
+  if (!currentPage) {
+    currentPage.reset(new PageBuilder());
+    currentPageNextY = 0;
+  }
+
+  // Images are scaled to fit the viewport, so one only moves on when the page already has something on it
+  if (currentPageNextY > 0 && currentPageNextY + height > viewportHeight) {
+    completePageFn(std::move(currentPage));
+    currentPage.reset(new PageBuilder());
+    currentPageNextY = 0;
+  }
+
+  currentPage->addImage(bmpPath, itemHref, (viewportWidth - width) / 2, currentPageNextY, width, height);
+  currentPageNextY += height;
+}
+
 void ChapterHtmlSlimParser::makePages() {
   if (!currentTextBlock) {
     Serial.printf("[%lu] [EHP] !! No text block to make pages for !!\n", millis());
@@ -331,14 +359,12 @@ void ChapterHtmlSlimParser::makePages() {
   }
 
   if (!currentPage) {
-    currentPage.reset(new Page());
+    currentPage.reset(new PageBuilder());
     currentPageNextY = 0;
   }
 
   const int lineHeight = renderer.getLineHeight(fontId) * lineCompression;
-  currentTextBlock->layoutAndExtractLines(
-      renderer, fontId, viewportWidth,
-      [this](const std::shared_ptr<TextBlock>& textBlock) { addLineToPage(textBlock); });
+  currentTextBlock->layoutAndExtractLines();
   // Extra paragraph spacing if enabled
   if (extraParagraphSpacing) {
     currentPageNextY += lineHeight / 2;
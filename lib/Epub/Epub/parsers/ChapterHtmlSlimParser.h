@@ -1,24 +1,32 @@
 #pragma once
 
+#include <ZipFile.h>
 #include <expat.h>
 
 #include <climits>
 #include <functional>
 #include <memory>
+#include <string>
 
 #include "../ParsedText.h"
 #include "../blocks/TextBlock.h"
 
-class Page;
+class PageBuilder;
 class GfxRenderer;
 
 #define MAX_WORD_SIZE 200
 
 class ChapterHtmlSlimParser {
-  const std::string& filepath;
+  ZipFile::EntryReader& source;
   GfxRenderer& renderer;
-  std::function<void(std::unique_ptr<Page>)> completePageFn;
+  std::function<void(std::unique_ptr<PageBuilder>)> completePageFn;
   std::function<void(int)> progressFn;  // Progress callback (0-100)
+  std::function<bool()> yieldFn;       // Called between input chunks, returning false aborts the build
+  // Resolves an <img> src to its item and the cached BMP it is drawn from along with the size that BMP will have once
+  // it is generated, returning false leaves the image out
+  using ImageFn =
+      std::function<bool(const char* src, std::string& itemHref, std::string& bmpPath, int* width, int* height)>;
+  ImageFn imageFn;
   int depth = 0;
   int skipUntilDepth = INT_MAX;
   int boldUntilDepth = INT_MAX;
@@ -28,7 +36,7 @@ class ChapterHtmlSlimParser {
   char partWordBuffer[MAX_WORD_SIZE + 1] = {};
   int partWordBufferIndex = 0;
   std::unique_ptr<ParsedText> currentTextBlock = nullptr;
-  std::unique_ptr<Page> currentPage = nullptr;
+  std::unique_ptr<PageBuilder> currentPage = nullptr;
   int16_t currentPageNextY = 0;
   int fontId;
   float lineCompression;
@@ -38,20 +46,27 @@ class ChapterHtmlSlimParser {
   uint16_t viewportHeight;
 
   void startNewTextBlock(TextBlock::Style style);
+  // Style of text at the current depth, from the bold and italic tags it sits in
+  EpdFontFamily::Style currentFontStyle() const;
+  // Adds the word built up in partWordBuffer to the current text block, if there is one
+  void flushPartWord(EpdFontFamily::Style style);
   void makePages();
+  void addImageToPage(const char* src);
   // XML callbacks
   static void XMLCALL startElement(void* userData, const XML_Char* name, const XML_Char** atts);
   static void XMLCALL characterData(void* userData, const XML_Char* s, int len);
   static void XMLCALL endElement(void* userData, const XML_Char* name);
 
  public:
-  explicit ChapterHtmlSlimParser(const std::string& filepath, GfxRenderer& renderer, const int fontId,
+  explicit ChapterHtmlSlimParser(ZipFile::EntryReader& source, GfxRenderer& renderer, const int fontId,
                                  const float lineCompression, const bool extraParagraphSpacing,
                                  const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                                  const uint16_t viewportHeight,
-                                 const std::function<void(std::unique_ptr<Page>)>& completePageFn,
-                                 const std::function<void(int)>& progressFn = nullptr)
-      : filepath(filepath),
+                                 const std::function<void(std::unique_ptr<PageBuilder>)>& completePageFn,
+                                 const std::function<void(int)>& progressFn = nullptr,
+                                 const std::function<bool()>& yieldFn = nullptr,
+                                 const ImageFn& imageFn = nullptr)
+      : source(source),
         renderer(renderer),
         fontId(fontId),
         lineCompression(lineCompression),
@@ -60,7 +75,9 @@ class ChapterHtmlSlimParser {
         viewportWidth(viewportWidth),
         viewportHeight(viewportHeight),
         completePageFn(completePageFn),
-        progressFn(progressFn) {}
+        progressFn(progressFn),
+        yieldFn(yieldFn),
+        imageFn(imageFn) {}
   ~ChapterHtmlSlimParser() = default;
   bool parseAndBuildPages();
   void addLineToPage(std::shared_ptr<TextBlock> line);
@@ -4,13 +4,116 @@
 #include <HardwareSerial.h>
 #include <Serialization.h>
 
+#include <algorithm>
+#include <functional>
+
 #include "../BookMetadataCache.h"
 
 namespace {
 constexpr char MEDIA_TYPE_NCX[] = "application/x-dtbncx+xml";
 constexpr char itemCacheFile[] = "/.items.bin";
+constexpr char itemRecordsFile[] = "/.items.rec";
+constexpr char itemIndexFile[] = "/.items.idx";
+// Number of index records sorted in RAM at a time while building the item index
+constexpr uint16_t ITEM_INDEX_BUILD_WINDOW = 512;
+
+struct ItemIndexRecord {
+  uint32_t idHash;
+  uint32_t storeOffset;
+};
+
+uint32_t hashItemId(const std::string& itemId) {
+  return static_cast<uint32_t>(std::hash<std::string>{}(itemId));
+}
 }  // namespace
 
+bool ContentOpfParser::buildItemIndex() {
+  FsFile recordsFile;
+  if (!SdMan.openFileForRead("COF", cachePath + itemRecordsFile, recordsFile)) {
+    return false;
+  }
+  if (!SdMan.openFileForWrite("COF", cachePath + itemIndexFile, tempItemIndex)) {
+    recordsFile.close();
+    return false;
+  }
+
+  const auto window = static_cast<ItemIndexRecord*>(malloc(ITEM_INDEX_BUILD_WINDOW * sizeof(ItemIndexRecord)));
+  if (!window) {
+    Serial.printf("[%lu] [COF] Couldn't allocate memory for item index\n", millis());
+    recordsFile.close();
+    tempItemIndex.close();
+    return false;
+  }
+
+  // Bucket counts were gathered while writing the manifest, turn them into start positions
+  for (uint16_t i = 0; i < ITEM_INDEX_BUCKETS; i++) {
+    itemBucketStarts[i + 1] += itemBucketStarts[i];
+  }
+
+  // Place records into bucket order through a fixed size window, one sequential pass over the records per window
+  bool success = true;
+  uint32_t bucketFill[ITEM_INDEX_BUCKETS];
+  for (uint32_t windowStart = 0; success && windowStart < itemCount; windowStart += ITEM_INDEX_BUILD_WINDOW) {
+    const uint32_t windowEnd = std::min(windowStart + ITEM_INDEX_BUILD_WINDOW, itemCount);
+    memset(bucketFill, 0, sizeof(bucketFill));
+    recordsFile.seek(0);
+
+    for (uint32_t i = 0; i < itemCount; i++) {
+      ItemIndexRecord record;
+      if (recordsFile.read(&record, sizeof(record)) != sizeof(record)) {
+        success = false;
+        break;
+      }
+      const uint16_t bucket = record.idHash % ITEM_INDEX_BUCKETS;
+      const uint32_t slot = itemBucketStarts[bucket] + bucketFill[bucket]++;
+      if (slot >= windowStart && slot < windowEnd) {
+        window[slot - windowStart] = record;
+      }
+    }
+
+    const size_t windowBytes = (windowEnd - windowStart) * sizeof(ItemIndexRecord);
+    success = success && tempItemIndex.write(reinterpret_cast<const uint8_t*>(window), windowBytes) == windowBytes;
+  }
+
+  free(window);
+  recordsFile.close();
+  tempItemIndex.close();
+  SdMan.remove((cachePath + itemRecordsFile).c_str());
+  return success;
+}
+
+bool ContentOpfParser::findItemHref(const std::string& itemId, std::string& href) {
+  const uint32_t idHash = hashItemId(itemId);
+  const uint16_t bucket = idHash % ITEM_INDEX_BUCKETS;
+
+  ItemIndexRecord records[16];
+  tempItemIndex.seek(itemBucketStarts[bucket] * sizeof(ItemIndexRecord));
+  for (uint32_t i = itemBucketStarts[bucket]; i < itemBucketStarts[bucket + 1];) {
+    const uint32_t count = std::min(itemBucketStarts[bucket + 1] - i, static_cast<uint32_t>(16));
+    if (tempItemIndex.read(records, count * sizeof(ItemIndexRecord)) != count * sizeof(ItemIndexRecord)) {
+      return false;
+    }
+    i += count;
+
+    for (uint32_t j = 0; j < count; j++) {
+      if (records[j].idHash != idHash) {
+        continue;
+      }
+
+      // Hash matched, confirm against the stored id
+      std::string storedId;
+      tempItemStore.seek(records[j].storeOffset);
+      serialization::readString(tempItemStore, storedId);
+      if (storedId == itemId) {
+        serialization::readString(tempItemStore, href);
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
 bool ContentOpfParser::setup() {
   parser = XML_ParserCreate(nullptr);
   if (!parser) {
@@ -35,8 +138,13 @@ ContentOpfParser::~ContentOpfParser() {
   if (tempItemStore) {
     tempItemStore.close();
   }
-  if (SdMan.exists((cachePath + itemCacheFile).c_str())) {
-    SdMan.remove((cachePath + itemCacheFile).c_str());
+  if (tempItemIndex) {
+    tempItemIndex.close();
+  }
+  for (const char* tempFile : {itemCacheFile, itemRecordsFile, itemIndexFile}) {
+    if (SdMan.exists((cachePath + tempFile).c_str())) {
+      SdMan.remove((cachePath + tempFile).c_str());
+    }
   }
 }
 
@@ -109,7 +217,8 @@ void XMLCALL ContentOpfParser::startElement(void* userData, const XML_Char* name
 
   if (self->state == IN_PACKAGE && (strcmp(name, "manifest") == 0 || strcmp(name, "opf:manifest") == 0)) {
     self->state = IN_MANIFEST;
-    if (!SdMan.openFileForWrite("COF", self->cachePath + itemCacheFile, self->tempItemStore)) {
+    if (!SdMan.openFileForWrite("COF", self->cachePath + itemCacheFile, self->tempItemStore) ||
+        !SdMan.openFileForWrite("COF", self->cachePath + itemRecordsFile, self->tempItemIndex)) {
       Serial.printf(
           "[%lu] [COF] Couldn't open temp items file for writing. This is probably going to be a fatal error.\n",
           millis());
@@ -119,7 +228,8 @@ void XMLCALL ContentOpfParser::startElement(void* userData, const XML_Char* name
 
   if (self->state == IN_PACKAGE && (strcmp(name, "spine") == 0 || strcmp(name, "opf:spine") == 0)) {
     self->state = IN_SPINE;
-    if (!SdMan.openFileForRead("COF", self->cachePath + itemCacheFile, self->tempItemStore)) {
+    if (!SdMan.openFileForRead("COF", self->cachePath + itemCacheFile, self->tempItemStore) ||
+        !SdMan.openFileForRead("COF", self->cachePath + itemIndexFile, self->tempItemIndex)) {
       Serial.printf(
           "[%lu] [COF] Couldn't open temp items file for reading. This is probably going to be a fatal error.\n",
           millis());
@@ -175,9 +285,13 @@ void XMLCALL ContentOpfParser::startElement(void* userData, const XML_Char* name
       }
     }
 
-    // Write items down to SD card
+    // Write items down to SD card, along with an index record to look them up by id later
+    const ItemIndexRecord record = {hashItemId(itemId), static_cast<uint32_t>(self->tempItemStore.position())};
     serialization::writeString(self->tempItemStore, itemId);
     serialization::writeString(self->tempItemStore, href);
+    self->tempItemIndex.write(reinterpret_cast<const uint8_t*>(&record), sizeof(record));
+    self->itemBucketStarts[record.idHash % ITEM_INDEX_BUCKETS + 1]++;
+    self->itemCount++;
 
     if (itemId == self->coverItemId) {
       self->coverItemHref = href;
@@ -210,20 +324,13 @@ void XMLCALL ContentOpfParser::startElement(void* userData, const XML_Char* name
       for (int i = 0; atts[i]; i += 2) {
         if (strcmp(atts[i], "idref") == 0) {
           const std::string idref = atts[i + 1];
-          // Resolve the idref to href using items map
-          // TODO: This lookup is slow as need to scan through all items each time.
-          //       It can take up to 200ms per item when getting to 1500 items.
-          self->tempItemStore.seek(0);
-          std::string itemId;
+          // Resolve the idref to href using the item index
+          const uint32_t start = millis();
           std::string href;
-          while (self->tempItemStore.available()) {
-            serialization::readString(self->tempItemStore, itemId);
-            serialization::readString(self->tempItemStore, href);
-            if (itemId == idref) {
-              self->cache->createSpineEntry(href);
-              break;
-            }
+          if (self->findItemHref(idref, href)) {
+            self->cache->createSpineEntry(href);
           }
+          self->spineResolveMs += millis() - start;
         }
       }
       return;
@@ -275,6 +382,9 @@ void XMLCALL ContentOpfParser::endElement(void* userData, const XML_Char* name)
   if (self->state == IN_SPINE && (strcmp(name, "spine") == 0 || strcmp(name, "opf:spine") == 0)) {
     self->state = IN_PACKAGE;
     self->tempItemStore.close();
+    self->tempItemIndex.close();
+    Serial.printf("[%lu] [COF] Resolved spine against %u manifest items in %lu ms\n", millis(), self->itemCount,
+                  self->spineResolveMs);
     return;
   }
 
@@ -287,6 +397,12 @@ void XMLCALL ContentOpfParser::endElement(void* userData, const XML_Char* name)
   if (self->state == IN_MANIFEST && (strcmp(name, "manifest") == 0 || strcmp(name, "opf:manifest") == 0)) {
     self->state = IN_PACKAGE;
     self->tempItemStore.close();
+    self->tempItemIndex.close();
+    const uint32_t start = millis();
+    if (!self->buildItemIndex()) {
+      Serial.printf("[%lu] [COF] Couldn't build item index. This is probably going to be a fatal error.\n", millis());
+    }
+    Serial.printf("[%lu] [COF] Indexed %u manifest items in %lu ms\n", millis(), self->itemCount, millis() - start);
     return;
   }
 
@@ -7,6 +7,8 @@
 class BookMetadataCache;
 
 class ContentOpfParser final : public Print {
+  static constexpr uint16_t ITEM_INDEX_BUCKETS = 256;
+
   enum ParserState {
     START,
     IN_PACKAGE,
@@ -25,8 +27,16 @@ class ContentOpfParser final : public Print {
   ParserState state = START;
   BookMetadataCache* cache;
   FsFile tempItemStore;
+  // Item id lookup index over tempItemStore, records are grouped into buckets by id hash
+  FsFile tempItemIndex;
+  uint32_t itemBucketStarts[ITEM_INDEX_BUCKETS + 1] = {};
+  uint32_t itemCount = 0;
+  uint32_t spineResolveMs = 0;
   std::string coverItemId;
 
+  bool buildItemIndex();
+  bool findItemHref(const std::string& itemId, std::string& href);
+
   static void startElement(void* userData, const XML_Char* name, const XML_Char** atts);
   static void characterData(void* userData, const XML_Char* s, int len);
   static void endElement(void* userData, const XML_Char* name);
@@ -71,7 +71,7 @@ static inline uint8_t quantize(int gray, int x, int y) {
 
 // Floyd-Steinberg quantization with error diffusion and serpentine scanning
 // Returns 2-bit value (0-3) and updates error buffers
-static inline uint8_t quantizeFloydSteinberg(int gray, int x, int width, int16_t* errorCurRow, int16_t* errorNextRow,
+static inline uint8_t quantizeFloydSteinberg(int gray, int x, int16_t* errorCurRow, int16_t* errorNextRow,
                                              bool reverseDir) {
   // Add accumulated error to this pixel
   int adjusted = gray + errorCurRow[x + 1];
@@ -284,7 +284,7 @@ BmpReaderError Bitmap::readNextRow(uint8_t* data, uint8_t* rowBuffer) const {
     uint8_t color;
     if (useFS) {
       // Floyd-Steinberg error diffusion
-      color = quantizeFloydSteinberg(lum, currentX, width, errorCurRow, errorNextRow, false);
+      color = quantizeFloydSteinberg(lum, currentX, errorCurRow, errorNextRow, false);
     } else {
       // Simple quantization or noise dithering
       color = quantize(lum, currentX, prevRowY);
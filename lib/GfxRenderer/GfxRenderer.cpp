@@ -2,8 +2,290 @@
 
 #include <Utf8.h>
 
+#include <algorithm>
+
+namespace {
+// How a glyph bitmap is laid onto the panel for each logical orientation: the panel step taken per glyph column
+// (glyph x) and per glyph row (glyph y). One of the two always runs along a panel row, which is what lets the blitter
+// build whole framebuffer bytes
+struct GlyphAxesSteps {
+  int colDx, colDy, rowDx, rowDy;
+};
+constexpr GlyphAxesSteps GLYPH_AXES[4] = {
+    {0, -1, 1, 0},   // Portrait
+    {-1, 0, 0, -1},  // LandscapeClockwise
+    {0, 1, -1, 0},   // PortraitInverted
+    {1, 0, 0, 1},    // LandscapeCounterClockwise
+};
+
+template <GfxRenderer::Orientation O>
+struct GlyphAxes {
+  static constexpr int colDx = GLYPH_AXES[O].colDx, colDy = GLYPH_AXES[O].colDy;
+  static constexpr int rowDx = GLYPH_AXES[O].rowDx, rowDy = GLYPH_AXES[O].rowDy;
+};
+
+// Narrows [first, last) so that start + step * i stays within [0, limit). A zero step is left to the other axis
+void clipAxis(const int start, const int step, const int limit, int* first, int* last) {
+  if (step > 0) {
+    *first = std::max(*first, -start);
+    *last = std::min(*last, limit - start);
+  } else if (step < 0) {
+    *first = std::max(*first, start - limit + 1);
+    *last = std::min(*last, start + 1);
+  }
+}
+
+// Draws one glyph with its (0, 0) pixel at panel position (panelX, panelY). The glyph rectangle is clipped to the
+// panel once, then every glyph line that falls on a panel row is merged into byte masks and written a byte at a time.
+// GRAYSCALE builds the LSB and MSB masks side by side and writes the MSB one to the same offset in msbPlane
+template <bool Is2Bit, GfxRenderer::RenderMode Mode, GfxRenderer::Orientation O>
+void blitGlyph(uint8_t* frameBuffer, uint8_t* msbPlane, const uint8_t* bitmap, const int width, const int height,
+               const int panelX, const int panelY, const bool pixelState) {
+  using Axes = GlyphAxes<O>;
+  // Grayscale passes only ever flag pixels (bit set), black in BW mode clears the bit
+  constexpr bool grayPass = Is2Bit && Mode != GfxRenderer::BW;
+  const bool setBits = grayPass || !pixelState;
+
+  int colFirst = 0, colLast = width, rowFirst = 0, rowLast = height;
+  clipAxis(panelX, Axes::colDx, EInkDisplay::DISPLAY_WIDTH, &colFirst, &colLast);
+  clipAxis(panelY, Axes::colDy, EInkDisplay::DISPLAY_HEIGHT, &colFirst, &colLast);
+  clipAxis(panelX, Axes::rowDx, EInkDisplay::DISPLAY_WIDTH, &rowFirst, &rowLast);
+  clipAxis(panelY, Axes::rowDy, EInkDisplay::DISPLAY_HEIGHT, &rowFirst, &rowLast);
+  if (colFirst >= colLast || rowFirst >= rowLast) {
+    return;
+  }
+
+  // Glyph rows lie along panel rows in landscape, glyph columns do in portrait
+  constexpr bool rowsAlongPanel = Axes::rowDx == 0;
+  const int lineFirst = rowsAlongPanel ? rowFirst : colFirst;
+  const int lineLast = rowsAlongPanel ? rowLast : colLast;
+  const int spanFirst = rowsAlongPanel ? colFirst : rowFirst;
+  const int spanLast = rowsAlongPanel ? colLast : rowLast;
+  constexpr int spanStep = rowsAlongPanel ? Axes::colDx : Axes::rowDx;
+  constexpr bool bothPlanes = Mode == GfxRenderer::GRAYSCALE;
+  const auto writeOut = [&](uint8_t* out, const uint8_t mask, const uint8_t msbMask) {
+    *out = setBits ? *out | mask : *out & ~mask;
+    if constexpr (bothPlanes) {
+      uint8_t* msbOut = msbPlane + (out - frameBuffer);
+      *msbOut = setBits ? *msbOut | msbMask : *msbOut & ~msbMask;
+    }
+  };
+
+  // Walking a span moves this far through the glyph bitmap per pixel
+  const int positionStep = rowsAlongPanel ? 1 : width;
+
+  for (int line = lineFirst; line < lineLast; line++) {
+    const int py = panelY + (rowsAlongPanel ? Axes::rowDy : Axes::colDy) * line;
+    const int px = panelX + spanStep * spanFirst;
+    uint8_t* out = frameBuffer + py * EInkDisplay::DISPLAY_WIDTH_BYTES + px / 8;
+    uint8_t bit = 0x80 >> (px % 8);
+    uint8_t mask = 0;
+    uint8_t msbMask = 0;
+    int pixelPosition = rowsAlongPanel ? line * width + spanFirst : spanFirst * width + line;
+
+    for (int span = spanFirst; span < spanLast; span++, pixelPosition += positionStep) {
+      bool paint;
+      bool msbPaint = false;
+      if constexpr (Is2Bit) {
+        // 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
+        const uint8_t value = (bitmap[pixelPosition >> 2] >> ((3 - (pixelPosition & 3)) * 2)) & 0x3;
+        if constexpr (Mode == GfxRenderer::BW) {
+          // Black (also paints over the grays in BW mode)
+          paint = value != 0;
+        } else if constexpr (Mode == GfxRenderer::GRAYSCALE_MSB) {
+          // Light gray (also mark the MSB if it's going to be a dark gray too)
+          paint = value == 1 || value == 2;
+        } else {
+          // Dark gray, plus the MSB pass's light or dark gray when drawing both planes
+          paint = value == 2;
+          msbPaint = value == 1 || value == 2;
+        }
+      } else {
+        paint = (bitmap[pixelPosition >> 3] >> (7 - (pixelPosition & 7))) & 1;
+        msbPaint = paint;
+      }
+      mask |= paint ? bit : 0;
+      if constexpr (bothPlanes) {
+        msbMask |= msbPaint ? bit : 0;
+      }
+
+      // Step to the next panel pixel, writing the finished byte out when crossing into the next one
+      if constexpr (spanStep > 0) {
+        bit >>= 1;
+        if (!bit) {
+          writeOut(out, mask, msbMask);
+          out++;
+          bit = 0x80;
+          mask = 0;
+          msbMask = 0;
+        }
+      } else {
+        bit <<= 1;
+        if (!bit) {
+          writeOut(out, mask, msbMask);
+          out--;
+          bit = 0x01;
+          mask = 0;
+          msbMask = 0;
+        }
+      }
+    }
+
+    if (mask || msbMask) {
+      writeOut(out, mask, msbMask);
+    }
+  }
+}
+
+// BW pass through the glyph cache. Returns false when the glyph has to go through blitGlyph instead, which is when it
+// hangs over the left or right edge of the panel or is too big to cache
+bool blitCachedGlyph(GlyphCache& cache, uint8_t* frameBuffer, const EpdFontData* fontData, const EpdGlyph* glyph,
+                     const int axes, const int panelX, const int panelY, const bool pixelState) {
+  const GlyphAxesSteps& steps = GLYPH_AXES[axes];
+  const bool rowsAlongPanel = steps.rowDx == 0;
+  const int lineCount = rowsAlongPanel ? glyph->height : glyph->width;
+  const int spanLength = rowsAlongPanel ? glyph->width : glyph->height;
+  const int spanStep = rowsAlongPanel ? steps.colDx : steps.rowDx;
+  const int lineStep = rowsAlongPanel ? steps.rowDy : steps.colDy;
+  const int leftX = spanStep > 0 ? panelX : panelX - spanLength + 1;
+  if (leftX < 0 || leftX + spanLength > EInkDisplay::DISPLAY_WIDTH) {
+    return false;
+  }
+
+  const int rowBytes = (spanLength + 7) / 8;
+  const uint8_t* bits = cache.find(glyph, axes);
+  if (!bits) {
+    uint8_t* newBits = cache.insert(glyph, axes, lineCount, rowBytes);
+    if (!newBits) {
+      return false;
+    }
+    // Unpack into panel order, every pixel the BW pass paints becomes a set bit
+    const uint8_t* bitmap = &fontData->bitmap[glyph->dataOffset];
+    for (int line = 0; line < lineCount; line++) {
+      uint8_t* row = newBits + line * rowBytes;
+      for (int k = 0; k < spanLength; k++) {
+        const int span = spanStep > 0 ? k : spanLength - 1 - k;
+        const int pixelPosition = rowsAlongPanel ? line * glyph->width + span : span * glyph->width + line;
+        const bool paint = fontData->is2Bit
+                               ? (bitmap[pixelPosition >> 2] >> ((3 - (pixelPosition & 3)) * 2) & 0x3) != 0
+                               : (bitmap[pixelPosition >> 3] >> (7 - (pixelPosition & 7)) & 1) != 0;
+        if (paint) {
+          row[k >> 3] |= 0x80 >> (k & 7);
+        }
+      }
+    }
+    bits = newBits;
+  }
+
+  int lineFirst = 0, lineLast = lineCount;
+  clipAxis(panelY, lineStep, EInkDisplay::DISPLAY_HEIGHT, &lineFirst, &lineLast);
+  const int shift = leftX % 8;
+  for (int line = lineFirst; line < lineLast; line++) {
+    const uint8_t* row = bits + line * rowBytes;
+    uint8_t* out = frameBuffer + (panelY + lineStep * line) * EInkDisplay::DISPLAY_WIDTH_BYTES + leftX / 8;
+    for (int i = 0; i < rowBytes; i++, out++) {
+      if (!row[i]) {
+        continue;
+      }
+      // Each cached byte straddles two framebuffer bytes unless the glyph happens to start on a byte boundary
+      const uint8_t high = row[i] >> shift;
+      const uint8_t low = shift ? row[i] << (8 - shift) : 0;
+      if (pixelState) {
+        out[0] &= ~high;
+        if (low) out[1] &= ~low;
+      } else {
+        out[0] |= high;
+        if (low) out[1] |= low;
+      }
+    }
+  }
+  return true;
+}
+
+using GlyphBlitter = void (*)(uint8_t*, uint8_t*, const uint8_t*, int, int, int, int, bool);
+
+template <bool Is2Bit, GfxRenderer::RenderMode Mode>
+constexpr GlyphBlitter blittersForMode[4] = {
+    blitGlyph<Is2Bit, Mode, GfxRenderer::Portrait>, blitGlyph<Is2Bit, Mode, GfxRenderer::LandscapeClockwise>,
+    blitGlyph<Is2Bit, Mode, GfxRenderer::PortraitInverted>,
+    blitGlyph<Is2Bit, Mode, GfxRenderer::LandscapeCounterClockwise>};
+
+template <bool Is2Bit>
+constexpr const GlyphBlitter* blittersForDepth[4] = {
+    blittersForMode<Is2Bit, GfxRenderer::BW>, blittersForMode<Is2Bit, GfxRenderer::GRAYSCALE_LSB>,
+    blittersForMode<Is2Bit, GfxRenderer::GRAYSCALE_MSB>, blittersForMode<Is2Bit, GfxRenderer::GRAYSCALE>};
+
+enum class SpanOp { Black, White, Invert };
+
+// Applies op to panel pixels [left, right] x [top, bottom], already clipped to the panel. Whole bytes of each row go
+// through memset (or a plain loop for invert), only the two edge bytes need masking
+void applyPanelSpans(uint8_t* frameBuffer, const int left, const int top, const int right, const int bottom,
+                     const SpanOp op) {
+  const int firstByte = left >> 3;
+  const int lastByte = right >> 3;
+  uint8_t firstMask = 0xFF >> (left & 7);
+  const uint8_t lastMask = 0xFF << (7 - (right & 7));
+  if (firstByte == lastByte) {
+    firstMask &= lastMask;
+  }
+  const int innerBytes = lastByte - firstByte - 1;
+  // Black pixels are cleared bits
+  const uint8_t fill = op == SpanOp::White ? 0xFF : 0x00;
+
+  for (int row = top; row <= bottom; row++) {
+    uint8_t* rowBytes = frameBuffer + row * EInkDisplay::DISPLAY_WIDTH_BYTES;
+    if (op == SpanOp::Invert) {
+      rowBytes[firstByte] ^= firstMask;
+      for (int i = 1; i <= innerBytes; i++) {
+        rowBytes[firstByte + i] = ~rowBytes[firstByte + i];
+      }
+      if (lastByte != firstByte) {
+        rowBytes[lastByte] ^= lastMask;
+      }
+      continue;
+    }
+
+    rowBytes[firstByte] = (rowBytes[firstByte] & ~firstMask) | (fill & firstMask);
+    if (innerBytes > 0) {
+      memset(rowBytes + firstByte + 1, fill, innerBytes);
+    }
+    if (lastByte != firstByte) {
+      rowBytes[lastByte] = (rowBytes[lastByte] & ~lastMask) | (fill & lastMask);
+    }
+  }
+}
+
+// Transposes an 8x8 bit block held as eight MSB first bytes, first byte in the top bits: bit 7 - i of output byte j
+// is bit 7 - j of input byte i
+uint64_t transpose8x8(uint64_t bits) {
+  uint64_t t = (bits ^ (bits >> 7)) & 0x00AA00AA00AA00AAull;
+  bits ^= t ^ (t << 7);
+  t = (bits ^ (bits >> 14)) & 0x0000CCCC0000CCCCull;
+  bits ^= t ^ (t << 14);
+  t = (bits ^ (bits >> 28)) & 0x00000000F0F0F0F0ull;
+  bits ^= t ^ (t << 28);
+  return bits;
+}
+
+// Past about half the panel a windowed refresh takes as long as a full one
+constexpr int WINDOWED_REFRESH_MAX_AREA = EInkDisplay::DISPLAY_WIDTH * EInkDisplay::DISPLAY_HEIGHT / 2;
+
+// FNV-1a, position dependent so moved content changes the signature as well
+constexpr uint32_t SIGNATURE_SEED = 2166136261u;
+constexpr uint32_t SIGNATURE_PRIME = 16777619u;
+}  // namespace
+
 void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) { fontMap.insert({fontId, font}); }
 
+const EpdFontFamily* GfxRenderer::getFontFamily(const int fontId) const {
+  const auto it = fontMap.find(fontId);
+  if (it == fontMap.end()) {
+    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+    return nullptr;
+  }
+  return &it->second;
+}
+
 void GfxRenderer::rotateCoordinates(const int x, const int y, int* rotatedX, int* rotatedY) const {
   switch (orientation) {
     case Portrait: {
@@ -44,6 +326,13 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
     return;
   }
 
+  drawPixelInto(frameBuffer, x, y, state);
+  if (renderMode == GRAYSCALE) {
+    drawPixelInto(grayMsbPlane, x, y, state);
+  }
+}
+
+void GfxRenderer::drawPixelInto(uint8_t* buffer, const int x, const int y, const bool state) const {
   int rotatedX = 0;
   int rotatedY = 0;
   rotateCoordinates(x, y, &rotatedX, &rotatedY);
@@ -60,21 +349,19 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
   const uint8_t bitPosition = 7 - (rotatedX % 8);  // MSB first
 
   if (state) {
-    frameBuffer[byteIndex] &= ~(1 << bitPosition);  // Clear bit
+    buffer[byteIndex] &= ~(1 << bitPosition);  // Clear bit
   } else {
-    frameBuffer[byteIndex] |= 1 << bitPosition;  // Set bit
+    buffer[byteIndex] |= 1 << bitPosition;  // Set bit
   }
 }
 
 int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontFamily::Style style) const {
-  if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+  const EpdFontFamily* font = getFontFamily(fontId);
+  if (!font) {
     return 0;
   }
 
-  int w = 0, h = 0;
-  fontMap.at(fontId).getTextDimensions(text, &w, &h, style);
-  return w;
+  return font->getTextWidth(text, style);
 }
 
 void GfxRenderer::drawCenteredText(const int fontId, const int y, const char* text, const bool black,
@@ -85,63 +372,165 @@ void GfxRenderer::drawCenteredText(const int fontId, const int y, const char* te
 
 void GfxRenderer::drawText(const int fontId, const int x, const int y, const char* text, const bool black,
                            const EpdFontFamily::Style style) const {
-  const int yPos = y + getFontAscenderSize(fontId);
-  int xpos = x;
-
   // cannot draw a NULL / empty string
   if (text == nullptr || *text == '\0') {
     return;
   }
 
-  if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
-    return;
-  }
-  const auto font = fontMap.at(fontId);
-
-  // no printable characters
-  if (!font.hasPrintableChars(text, style)) {
+  const EpdFontFamily* font = getFontFamily(fontId);
+  if (!font) {
     return;
   }
 
+  // Text without printable characters simply draws nothing, there is no need to measure it up front
+  const int yPos = y + font->getData(EpdFontFamily::REGULAR)->ascender;
+  int xpos = x;
   uint32_t cp;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
-    renderChar(font, cp, &xpos, &yPos, black, style);
+    renderChar(*font, cp, &xpos, &yPos, black, style);
+  }
+}
+
+bool GfxRenderer::rotateRect(const int x, const int y, const int width, const int height, int* panelLeft,
+                             int* panelTop, int* panelRight, int* panelBottom) const {
+  if (width <= 0 || height <= 0) {
+    return false;
   }
+
+  int x1 = 0;
+  int y1 = 0;
+  int x2 = 0;
+  int y2 = 0;
+  rotateCoordinates(x, y, &x1, &y1);
+  rotateCoordinates(x + width - 1, y + height - 1, &x2, &y2);
+  *panelLeft = std::max(std::min(x1, x2), 0);
+  *panelRight = std::min(std::max(x1, x2), EInkDisplay::DISPLAY_WIDTH - 1);
+  *panelTop = std::max(std::min(y1, y2), 0);
+  *panelBottom = std::min(std::max(y1, y2), EInkDisplay::DISPLAY_HEIGHT - 1);
+  return *panelLeft <= *panelRight && *panelTop <= *panelBottom;
 }
 
 void GfxRenderer::drawLine(int x1, int y1, int x2, int y2, const bool state) const {
-  if (x1 == x2) {
-    if (y2 < y1) {
-      std::swap(y1, y2);
-    }
-    for (int y = y1; y <= y2; y++) {
-      drawPixel(x1, y, state);
+  if (x1 == x2 || y1 == y2) {
+    fillRect(std::min(x1, x2), std::min(y1, y2), std::abs(x2 - x1) + 1, std::abs(y2 - y1) + 1, state);
+    return;
+  }
+
+  // Bresenham
+  const int dx = std::abs(x2 - x1);
+  const int dy = -std::abs(y2 - y1);
+  const int stepX = x1 < x2 ? 1 : -1;
+  const int stepY = y1 < y2 ? 1 : -1;
+  int error = dx + dy;
+  while (true) {
+    drawPixel(x1, y1, state);
+    if (x1 == x2 && y1 == y2) {
+      break;
     }
-  } else if (y1 == y2) {
-    if (x2 < x1) {
-      std::swap(x1, x2);
+    const int error2 = 2 * error;
+    if (error2 >= dy) {
+      error += dy;
+      x1 += stepX;
     }
-    for (int x = x1; x <= x2; x++) {
-      drawPixel(x, y1, state);
+    if (error2 <= dx) {
+      error += dx;
+      y1 += stepY;
     }
-  } else {
-    // TODO: Implement
-    Serial.printf("[%lu] [GFX] Line drawing not supported\n", millis());
   }
 }
 
 void GfxRenderer::drawRect(const int x, const int y, const int width, const int height, const bool state) const {
-  drawLine(x, y, x + width - 1, y, state);
-  drawLine(x + width - 1, y, x + width - 1, y + height - 1, state);
-  drawLine(x + width - 1, y + height - 1, x, y + height - 1, state);
-  drawLine(x, y, x, y + height - 1, state);
+  if (width <= 0 || height <= 0) {
+    return;
+  }
+  fillRect(x, y, width, 1, state);
+  fillRect(x, y + height - 1, width, 1, state);
+  fillRect(x, y + 1, 1, height - 2, state);
+  fillRect(x + width - 1, y + 1, 1, height - 2, state);
 }
 
 void GfxRenderer::fillRect(const int x, const int y, const int width, const int height, const bool state) const {
-  for (int fillY = y; fillY < y + height; fillY++) {
-    drawLine(x, fillY, x + width - 1, fillY, state);
+  uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  int left, top, right, bottom;
+  if (!frameBuffer || !rotateRect(x, y, width, height, &left, &top, &right, &bottom)) {
+    return;
   }
+  applyPanelSpans(frameBuffer, left, top, right, bottom, state ? SpanOp::Black : SpanOp::White);
+}
+
+void GfxRenderer::clearRect(const int x, const int y, const int width, const int height) const {
+  fillRect(x, y, width, height, false);
+}
+
+void GfxRenderer::invertRect(const int x, const int y, const int width, const int height) const {
+  uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  int left, top, right, bottom;
+  if (!frameBuffer || !rotateRect(x, y, width, height, &left, &top, &right, &bottom)) {
+    return;
+  }
+  applyPanelSpans(frameBuffer, left, top, right, bottom, SpanOp::Invert);
+}
+
+void GfxRenderer::cornerInsets(const int radius, int* insets) {
+  // Rows of a quarter circle centred on the last corner row and column, walked from the top row down. The extent
+  // only grows row by row, so it is tracked incrementally instead of taking square roots
+  const int limit = radius * radius - radius;
+  int extent = 0;
+  for (int row = 0; row < radius; row++) {
+    const int distance = radius - 1 - row;
+    while ((extent + 1) * (extent + 1) + distance * distance <= limit) {
+      extent++;
+    }
+    insets[row] = radius - 1 - extent;
+  }
+}
+
+void GfxRenderer::drawRoundedRect(const int x, const int y, const int width, const int height, int radius,
+                                  const bool state) const {
+  radius = std::min(radius, std::min(width, height) / 2);
+  if (radius <= 1) {
+    drawRect(x, y, width, height, state);
+    return;
+  }
+
+  int insets[MAX_CORNER_RADIUS];
+  radius = std::min(radius, MAX_CORNER_RADIUS);
+  cornerInsets(radius, insets);
+
+  fillRect(x + radius, y, width - 2 * radius, 1, state);
+  fillRect(x + radius, y + height - 1, width - 2 * radius, 1, state);
+  fillRect(x, y + radius, 1, height - 2 * radius, state);
+  fillRect(x + width - 1, y + radius, 1, height - 2 * radius, state);
+
+  // Each corner row runs from its own inset to just short of the row above's, so the arc has no gaps
+  for (int row = 0; row < radius; row++) {
+    const int start = insets[row];
+    const int end = row == 0 ? radius - 1 : std::max(start, insets[row - 1] - 1);
+    const int runWidth = end - start + 1;
+    fillRect(x + start, y + row, runWidth, 1, state);
+    fillRect(x + width - 1 - end, y + row, runWidth, 1, state);
+    fillRect(x + start, y + height - 1 - row, runWidth, 1, state);
+    fillRect(x + width - 1 - end, y + height - 1 - row, runWidth, 1, state);
+  }
+}
+
+void GfxRenderer::fillRoundedRect(const int x, const int y, const int width, const int height, int radius,
+                                  const bool state) const {
+  radius = std::min(radius, std::min(width, height) / 2);
+  if (radius <= 1) {
+    fillRect(x, y, width, height, state);
+    return;
+  }
+
+  int insets[MAX_CORNER_RADIUS];
+  radius = std::min(radius, MAX_CORNER_RADIUS);
+  cornerInsets(radius, insets);
+
+  for (int row = 0; row < radius; row++) {
+    fillRect(x + insets[row], y + row, width - 2 * insets[row], 1, state);
+    fillRect(x + insets[row], y + height - 1 - row, width - 2 * insets[row], 1, state);
+  }
+  fillRect(x, y + radius, width, height - 2 * radius, state);
 }
 
 void GfxRenderer::drawImage(const uint8_t bitmap[], const int x, const int y, const int width, const int height) const {
@@ -152,6 +541,109 @@ void GfxRenderer::drawImage(const uint8_t bitmap[], const int x, const int y, co
   einkDisplay.drawImage(bitmap, rotatedX, rotatedY, width, height);
 }
 
+void GfxRenderer::drawPackedRows(const uint8_t* bits, const int width, const int height) const {
+  uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  if (!frameBuffer || renderMode != BW) {
+    return;
+  }
+
+  const int rowBytes = (width + 7) / 8;
+  if (orientation == Portrait && width % 8 == 0 && height % 8 == 0 && width <= EInkDisplay::DISPLAY_HEIGHT &&
+      height <= EInkDisplay::DISPLAY_WIDTH) {
+    // Logical (x, y) is panel (y, 479 - x): each 8x8 block of the page turns into 8 bytes down one panel byte column
+    for (int blockY = 0; blockY < height; blockY += 8) {
+      for (int byteX = 0; byteX < rowBytes; byteX++) {
+        const uint8_t* src = bits + blockY * rowBytes + byteX;
+        uint64_t block = 0;
+        for (int i = 0; i < 8; i++) {
+          block = block << 8 | src[i * rowBytes];
+        }
+        block = transpose8x8(block);
+
+        uint8_t* dst = frameBuffer + (EInkDisplay::DISPLAY_HEIGHT - 1 - byteX * 8) * EInkDisplay::DISPLAY_WIDTH_BYTES +
+                       blockY / 8;
+        for (int j = 0; j < 8; j++) {
+          *dst = static_cast<uint8_t>(block >> (56 - j * 8));
+          dst -= EInkDisplay::DISPLAY_WIDTH_BYTES;
+        }
+      }
+    }
+    return;
+  }
+
+  for (int y = 0; y < height; y++) {
+    const uint8_t* row = bits + y * rowBytes;
+    for (int x = 0; x < width; x++) {
+      drawPixel(x, y, !(row[x / 8] >> (7 - x % 8) & 1));
+    }
+  }
+}
+
+void GfxRenderer::drawColumnPlanes(const uint8_t* plane1, const uint8_t* plane2, const int width,
+                                   const int height) const {
+  uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  if (!frameBuffer) {
+    return;
+  }
+
+  const int columnBytes = (height + 7) / 8;
+  if (orientation == Portrait && height % 8 == 0 && width <= EInkDisplay::DISPLAY_HEIGHT &&
+      height <= EInkDisplay::DISPLAY_WIDTH) {
+    // Logical (x, y) is panel (y, 479 - x), so a stored column (counted from the right edge) is exactly one panel row
+    // with its bytes in panel order. Only the per pixel value mapping is left to do, on whole bytes
+    uint8_t* dst = frameBuffer + (EInkDisplay::DISPLAY_HEIGHT - width) * EInkDisplay::DISPLAY_WIDTH_BYTES;
+    const size_t planeSize = static_cast<size_t>(width) * columnBytes;
+    for (size_t offset = 0; offset < planeSize; offset += columnBytes) {
+      const uint8_t* bits1 = plane1 + offset;
+      const uint8_t* bits2 = plane2 + offset;
+      for (int i = 0; i < columnBytes; i++) {
+        switch (renderMode) {
+          case BW:
+            // Anything but white is black, black pixels are cleared bits
+            dst[i] = ~(bits1[i] | bits2[i]);
+            break;
+          case GRAYSCALE_LSB:
+            // Dark grey (1)
+            dst[i] = ~bits1[i] & bits2[i];
+            break;
+          case GRAYSCALE_MSB:
+            // Dark or light grey (1 or 2)
+            dst[i] = bits1[i] ^ bits2[i];
+            break;
+          case GRAYSCALE:
+            // Both of the above, the MSB plane lines up byte for byte with the framebuffer
+            dst[i] = ~bits1[i] & bits2[i];
+            grayMsbPlane[dst - frameBuffer + i] = bits1[i] ^ bits2[i];
+            break;
+        }
+      }
+      dst += EInkDisplay::DISPLAY_WIDTH_BYTES;
+    }
+    return;
+  }
+
+  for (int x = 0; x < width; x++) {
+    const size_t columnOffset = static_cast<size_t>(width - 1 - x) * columnBytes;
+    for (int y = 0; y < height; y++) {
+      const size_t byteOffset = columnOffset + y / 8;
+      const int shift = 7 - y % 8;
+      const uint8_t value = (plane1[byteOffset] >> shift & 1) << 1 | (plane2[byteOffset] >> shift & 1);
+      if (renderMode == BW && value >= 1) {
+        drawPixel(x, y, true);
+      } else if (renderMode == GRAYSCALE_MSB && (value == 1 || value == 2)) {
+        drawPixel(x, y, false);
+      } else if (renderMode == GRAYSCALE_LSB && value == 1) {
+        drawPixel(x, y, false);
+      } else if (renderMode == GRAYSCALE && (value == 1 || value == 2)) {
+        drawPixelInto(grayMsbPlane, x, y, false);
+        if (value == 1) {
+          drawPixelInto(frameBuffer, x, y, false);
+        }
+      }
+    }
+  }
+}
+
 void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, const int maxWidth, const int maxHeight,
                              const float cropX, const float cropY) const {
   float scale = 1.0f;
@@ -226,6 +718,11 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
         drawPixel(screenX, screenY, false);
       } else if (renderMode == GRAYSCALE_LSB && val == 1) {
         drawPixel(screenX, screenY, false);
+      } else if (renderMode == GRAYSCALE && (val == 1 || val == 2)) {
+        drawPixelInto(grayMsbPlane, screenX, screenY, false);
+        if (val == 1) {
+          drawPixelInto(einkDisplay.getFrameBuffer(), screenX, screenY, false);
+        }
       }
     }
   }
@@ -242,24 +739,125 @@ void GfxRenderer::invertScreen() const {
     Serial.printf("[%lu] [GFX] !! No framebuffer in invertScreen\n", millis());
     return;
   }
-  for (int i = 0; i < EInkDisplay::BUFFER_SIZE; i++) {
+  for (uint32_t i = 0; i < EInkDisplay::BUFFER_SIZE; i++) {
     buffer[i] = ~buffer[i];
   }
 }
 
 void GfxRenderer::displayBuffer(const EInkDisplay::RefreshMode refreshMode) const {
+  int firstRow, lastRow, firstColumn, lastColumn;
+  updateShownSignatures(&firstRow, &lastRow, &firstColumn, &lastColumn);
   einkDisplay.displayBuffer(refreshMode);
 }
 
+void GfxRenderer::displayWindow(const int x, const int y, const int width, const int height) const {
+  int left, top, right, bottom;
+  if (!rotateRect(x, y, width, height, &left, &top, &right, &bottom)) {
+    return;
+  }
+
+  left &= ~7;
+  right |= 7;
+  einkDisplay.displayWindow(left, top, right - left + 1, bottom - top + 1);
+  // Only part of the frame went out, the signatures no longer describe what the panel shows
+  shownSignaturesValid = false;
+}
+
+void GfxRenderer::flush(const EInkDisplay::RefreshMode refreshMode) const {
+  if (!einkDisplay.getFrameBuffer()) {
+    Serial.printf("[%lu] [GFX] !! No framebuffer in flush\n", millis());
+    return;
+  }
+
+  const bool signaturesWereValid = shownSignaturesValid;
+  int firstRow, lastRow, firstColumn, lastColumn;
+  const bool changed = updateShownSignatures(&firstRow, &lastRow, &firstColumn, &lastColumn);
+  if (signaturesWereValid && !changed) {
+    return;
+  }
+
+  const int windowWidth = (lastColumn - firstColumn + 1) * 8;
+  const int windowHeight = lastRow - firstRow + 1;
+  if (!signaturesWereValid || refreshMode != EInkDisplay::FAST_REFRESH ||
+      windowWidth * windowHeight > WINDOWED_REFRESH_MAX_AREA) {
+    einkDisplay.displayBuffer(refreshMode);
+    return;
+  }
+
+  einkDisplay.displayWindow(firstColumn * 8, firstRow, windowWidth, windowHeight);
+}
+
+bool GfxRenderer::updateShownSignatures(int* firstRow, int* lastRow, int* firstColumn, int* lastColumn) const {
+  const uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  *firstRow = EInkDisplay::DISPLAY_HEIGHT;
+  *lastRow = -1;
+  *firstColumn = EInkDisplay::DISPLAY_WIDTH_BYTES;
+  *lastColumn = -1;
+  if (!frameBuffer) {
+    shownSignaturesValid = false;
+    return false;
+  }
+
+  uint32_t columnSignatures[EInkDisplay::DISPLAY_WIDTH_BYTES];
+  std::fill_n(columnSignatures, EInkDisplay::DISPLAY_WIDTH_BYTES, SIGNATURE_SEED);
+
+  for (int row = 0; row < EInkDisplay::DISPLAY_HEIGHT; row++) {
+    const uint8_t* rowBytes = frameBuffer + row * EInkDisplay::DISPLAY_WIDTH_BYTES;
+    uint32_t rowSignature = SIGNATURE_SEED;
+    for (int column = 0; column < EInkDisplay::DISPLAY_WIDTH_BYTES; column++) {
+      rowSignature = (rowSignature ^ rowBytes[column]) * SIGNATURE_PRIME;
+      columnSignatures[column] = (columnSignatures[column] ^ rowBytes[column]) * SIGNATURE_PRIME;
+    }
+    if (rowSignature != shownRowSignatures[row]) {
+      shownRowSignatures[row] = rowSignature;
+      *firstRow = std::min(*firstRow, row);
+      *lastRow = row;
+    }
+  }
+
+  for (int column = 0; column < EInkDisplay::DISPLAY_WIDTH_BYTES; column++) {
+    if (columnSignatures[column] != shownColumnSignatures[column]) {
+      shownColumnSignatures[column] = columnSignatures[column];
+      *firstColumn = std::min(*firstColumn, column);
+      *lastColumn = column;
+    }
+  }
+
+  shownSignaturesValid = true;
+  if (*lastRow < 0 && *lastColumn < 0) {
+    return false;
+  }
+  // A change shows up in both its row and its column signature, unless changes within one of them cancel out. The
+  // whole panel is the only safe window then
+  if (*lastRow < 0 || *lastColumn < 0) {
+    *firstRow = 0;
+    *lastRow = EInkDisplay::DISPLAY_HEIGHT - 1;
+    *firstColumn = 0;
+    *lastColumn = EInkDisplay::DISPLAY_WIDTH_BYTES - 1;
+  }
+  return true;
+}
+
+size_t GfxRenderer::fitText(const int fontId, const char* text, const int maxWidth, const char* ellipsis,
+                            const EpdFontFamily::Style style, int* fitWidth) const {
+  const EpdFontFamily* font = getFontFamily(fontId);
+  if (!font) {
+    if (fitWidth) {
+      *fitWidth = 0;
+    }
+    return 0;
+  }
+
+  return font->fitText(text, maxWidth, ellipsis, fitWidth, style);
+}
+
 std::string GfxRenderer::truncatedText(const int fontId, const char* text, const int maxWidth,
-                                       const EpdFontFamily::Style style) const {
-  std::string item = text;
-  int itemWidth = getTextWidth(fontId, item.c_str(), style);
-  while (itemWidth > maxWidth && item.length() > 8) {
-    item.replace(item.length() - 5, 5, "...");
-    itemWidth = getTextWidth(fontId, item.c_str(), style);
+                                       const EpdFontFamily::Style style, int* textWidth) const {
+  const size_t fitLength = fitText(fontId, text, maxWidth, "...", style, textWidth);
+  if (text[fitLength] == '\0') {
+    return text;
   }
-  return item;
+  return std::string(text, fitLength) + "...";
 }
 
 // Note: Internal driver treats screen in command orientation; this library exposes a logical orientation
@@ -292,30 +890,30 @@ int GfxRenderer::getScreenHeight() const {
 }
 
 int GfxRenderer::getSpaceWidth(const int fontId) const {
-  if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+  const EpdFontFamily* font = getFontFamily(fontId);
+  if (!font) {
     return 0;
   }
 
-  return fontMap.at(fontId).getGlyph(' ', EpdFontFamily::REGULAR)->advanceX;
+  return font->getGlyph(' ', EpdFontFamily::REGULAR)->advanceX;
 }
 
 int GfxRenderer::getFontAscenderSize(const int fontId) const {
-  if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+  const EpdFontFamily* font = getFontFamily(fontId);
+  if (!font) {
     return 0;
   }
 
-  return fontMap.at(fontId).getData(EpdFontFamily::REGULAR)->ascender;
+  return font->getData(EpdFontFamily::REGULAR)->ascender;
 }
 
 int GfxRenderer::getLineHeight(const int fontId) const {
-  if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+  const EpdFontFamily* font = getFontFamily(fontId);
+  if (!font) {
     return 0;
   }
 
-  return fontMap.at(fontId).getData(EpdFontFamily::REGULAR)->advanceY;
+  return font->getData(EpdFontFamily::REGULAR)->advanceY;
 }
 
 void GfxRenderer::drawButtonHints(const int fontId, const char* btn1, const char* btn2, const char* btn3,
@@ -392,11 +990,11 @@ void GfxRenderer::drawSideButtonHints(const int fontId, const char* topBtn, cons
 }
 
 int GfxRenderer::getTextHeight(const int fontId) const {
-  if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+  const EpdFontFamily* font = getFontFamily(fontId);
+  if (!font) {
     return 0;
   }
-  return fontMap.at(fontId).getData(EpdFontFamily::REGULAR)->ascender;
+  return font->getData(EpdFontFamily::REGULAR)->ascender;
 }
 
 void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y, const char* text, const bool black,
@@ -406,14 +1004,8 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
     return;
   }
 
-  if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
-    return;
-  }
-  const auto font = fontMap.at(fontId);
-
-  // No printable characters
-  if (!font.hasPrintableChars(text, style)) {
+  const EpdFontFamily* font = getFontFamily(fontId);
+  if (!font) {
     return;
   }
 
@@ -425,57 +1017,17 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
 
   uint32_t cp;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
-    const EpdGlyph* glyph = font.getGlyph(cp, style);
+    const EpdGlyph* glyph = font->getGlyph(cp, style);
     if (!glyph) {
-      glyph = font.getGlyph('?', style);
+      glyph = font->getGlyph('?', style);
     }
     if (!glyph) {
       continue;
     }
 
-    const int is2Bit = font.getData(style)->is2Bit;
-    const uint32_t offset = glyph->dataOffset;
-    const uint8_t width = glyph->width;
-    const uint8_t height = glyph->height;
-    const int left = glyph->left;
-    const int top = glyph->top;
-
-    const uint8_t* bitmap = &font.getData(style)->bitmap[offset];
-
-    if (bitmap != nullptr) {
-      for (int glyphY = 0; glyphY < height; glyphY++) {
-        for (int glyphX = 0; glyphX < width; glyphX++) {
-          const int pixelPosition = glyphY * width + glyphX;
-
-          // 90° clockwise rotation transformation:
-          // screenX = x + (ascender - top + glyphY)
-          // screenY = yPos - (left + glyphX)
-          const int screenX = x + (font.getData(style)->ascender - top + glyphY);
-          const int screenY = yPos - left - glyphX;
-
-          if (is2Bit) {
-            const uint8_t byte = bitmap[pixelPosition / 4];
-            const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
-            const uint8_t bmpVal = 3 - (byte >> bit_index) & 0x3;
-
-            if (renderMode == BW && bmpVal < 3) {
-              drawPixel(screenX, screenY, black);
-            } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
-              drawPixel(screenX, screenY, false);
-            } else if (renderMode == GRAYSCALE_LSB && bmpVal == 1) {
-              drawPixel(screenX, screenY, false);
-            }
-          } else {
-            const uint8_t byte = bitmap[pixelPosition / 8];
-            const uint8_t bit_index = 7 - (pixelPosition % 8);
-
-            if ((byte >> bit_index) & 1) {
-              drawPixel(screenX, screenY, black);
-            }
-          }
-        }
-      }
-    }
+    // Glyph pixel (0, 0) lands at screenX = x + (ascender - top), screenY = yPos - left
+    const EpdFontData* fontData = font->getData(style);
+    drawGlyph(fontData, glyph, x + fontData->ascender - glyph->top, yPos - glyph->left, true, black);
 
     // Move to next character position (going up, so decrease Y)
     yPos -= glyph->advanceX;
@@ -486,108 +1038,47 @@ uint8_t* GfxRenderer::getFrameBuffer() const { return einkDisplay.getFrameBuffer
 
 size_t GfxRenderer::getBufferSize() { return EInkDisplay::BUFFER_SIZE; }
 
-void GfxRenderer::grayscaleRevert() const { einkDisplay.grayscaleRevert(); }
+void GfxRenderer::grayscaleRevert() const {
+  einkDisplay.grayscaleRevert();
+  shownSignaturesValid = false;
+}
 
 void GfxRenderer::copyGrayscaleLsbBuffers() const { einkDisplay.copyGrayscaleLsbBuffers(einkDisplay.getFrameBuffer()); }
 
 void GfxRenderer::copyGrayscaleMsbBuffers() const { einkDisplay.copyGrayscaleMsbBuffers(einkDisplay.getFrameBuffer()); }
 
-void GfxRenderer::displayGrayBuffer() const { einkDisplay.displayGrayBuffer(); }
-
-void GfxRenderer::freeBwBufferChunks() {
-  for (auto& bwBufferChunk : bwBufferChunks) {
-    if (bwBufferChunk) {
-      free(bwBufferChunk);
-      bwBufferChunk = nullptr;
-    }
-  }
+void GfxRenderer::displayGrayBuffer() const {
+  einkDisplay.displayGrayBuffer();
+  shownSignaturesValid = false;
 }
 
-/**
- * This should be called before grayscale buffers are populated.
- * A `restoreBwBuffer` call should always follow the grayscale render if this method was called.
- * Uses chunked allocation to avoid needing 48KB of contiguous memory.
- * Returns true if buffer was stored successfully, false if allocation failed.
- */
-bool GfxRenderer::storeBwBuffer() {
-  const uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
-  if (!frameBuffer) {
-    Serial.printf("[%lu] [GFX] !! No framebuffer in storeBwBuffer\n", millis());
-    return false;
+bool GfxRenderer::beginGrayscale() {
+  if (!grayMsbPlane) {
+    grayMsbPlane = static_cast<uint8_t*>(malloc(EInkDisplay::BUFFER_SIZE));
   }
-
-  // Allocate and copy each chunk
-  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
-    // Check if any chunks are already allocated
-    if (bwBufferChunks[i]) {
-      Serial.printf("[%lu] [GFX] !! BW buffer chunk %zu already stored - this is likely a bug, freeing chunk\n",
-                    millis(), i);
-      free(bwBufferChunks[i]);
-      bwBufferChunks[i] = nullptr;
-    }
-
-    const size_t offset = i * BW_BUFFER_CHUNK_SIZE;
-    bwBufferChunks[i] = static_cast<uint8_t*>(malloc(BW_BUFFER_CHUNK_SIZE));
-
-    if (!bwBufferChunks[i]) {
-      Serial.printf("[%lu] [GFX] !! Failed to allocate BW buffer chunk %zu (%zu bytes)\n", millis(), i,
-                    BW_BUFFER_CHUNK_SIZE);
-      // Free previously allocated chunks
-      freeBwBufferChunks();
-      return false;
-    }
-
-    memcpy(bwBufferChunks[i], frameBuffer + offset, BW_BUFFER_CHUNK_SIZE);
+  if (!grayMsbPlane) {
+    Serial.printf("[%lu] [GFX] !! Failed to allocate MSB plane (%u bytes)\n", millis(), EInkDisplay::BUFFER_SIZE);
+    return false;
   }
 
-  Serial.printf("[%lu] [GFX] Stored BW buffer in %zu chunks (%zu bytes each)\n", millis(), BW_BUFFER_NUM_CHUNKS,
-                BW_BUFFER_CHUNK_SIZE);
+  einkDisplay.clearScreen(0x00);
+  memset(grayMsbPlane, 0x00, EInkDisplay::BUFFER_SIZE);
+  renderMode = GRAYSCALE;
   return true;
 }
 
-/**
- * This can only be called if `storeBwBuffer` was called prior to the grayscale render.
- * It should be called to restore the BW buffer state after grayscale rendering is complete.
- * Uses chunked restoration to match chunked storage.
- */
-void GfxRenderer::restoreBwBuffer() {
-  // Check if any all chunks are allocated
-  bool missingChunks = false;
-  for (const auto& bwBufferChunk : bwBufferChunks) {
-    if (!bwBufferChunk) {
-      missingChunks = true;
-      break;
-    }
+void GfxRenderer::copyGrayscaleBuffers() {
+  einkDisplay.copyGrayscaleLsbBuffers(einkDisplay.getFrameBuffer());
+  if (grayMsbPlane) {
+    einkDisplay.copyGrayscaleMsbBuffers(grayMsbPlane);
   }
+  freeGrayMsbPlane();
+  renderMode = BW;
+}
 
-  if (missingChunks) {
-    freeBwBufferChunks();
-    return;
-  }
-
-  uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
-  if (!frameBuffer) {
-    Serial.printf("[%lu] [GFX] !! No framebuffer in restoreBwBuffer\n", millis());
-    freeBwBufferChunks();
-    return;
-  }
-
-  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
-    // Check if chunk is missing
-    if (!bwBufferChunks[i]) {
-      Serial.printf("[%lu] [GFX] !! BW buffer chunks not stored - this is likely a bug\n", millis());
-      freeBwBufferChunks();
-      return;
-    }
-
-    const size_t offset = i * BW_BUFFER_CHUNK_SIZE;
-    memcpy(frameBuffer + offset, bwBufferChunks[i], BW_BUFFER_CHUNK_SIZE);
-  }
-
-  einkDisplay.cleanupGrayscaleBuffers(frameBuffer);
-
-  freeBwBufferChunks();
-  Serial.printf("[%lu] [GFX] Restored and freed BW buffer chunks\n", millis());
+void GfxRenderer::freeGrayMsbPlane() {
+  free(grayMsbPlane);
+  grayMsbPlane = nullptr;
 }
 
 /**
@@ -615,54 +1106,35 @@ void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp,
     return;
   }
 
-  const int is2Bit = fontFamily.getData(style)->is2Bit;
-  const uint32_t offset = glyph->dataOffset;
-  const uint8_t width = glyph->width;
-  const uint8_t height = glyph->height;
-  const int left = glyph->left;
-
-  const uint8_t* bitmap = nullptr;
-  bitmap = &fontFamily.getData(style)->bitmap[offset];
-
-  if (bitmap != nullptr) {
-    for (int glyphY = 0; glyphY < height; glyphY++) {
-      const int screenY = *y - glyph->top + glyphY;
-      for (int glyphX = 0; glyphX < width; glyphX++) {
-        const int pixelPosition = glyphY * width + glyphX;
-        const int screenX = *x + left + glyphX;
-
-        if (is2Bit) {
-          const uint8_t byte = bitmap[pixelPosition / 4];
-          const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
-          // the direct bit from the font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
-          // we swap this to better match the way images and screen think about colors:
-          // 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
-          const uint8_t bmpVal = 3 - (byte >> bit_index) & 0x3;
-
-          if (renderMode == BW && bmpVal < 3) {
-            // Black (also paints over the grays in BW mode)
-            drawPixel(screenX, screenY, pixelState);
-          } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
-            // Light gray (also mark the MSB if it's going to be a dark gray too)
-            // We have to flag pixels in reverse for the gray buffers, as 0 leave alone, 1 update
-            drawPixel(screenX, screenY, false);
-          } else if (renderMode == GRAYSCALE_LSB && bmpVal == 1) {
-            // Dark gray
-            drawPixel(screenX, screenY, false);
-          }
-        } else {
-          const uint8_t byte = bitmap[pixelPosition / 8];
-          const uint8_t bit_index = 7 - (pixelPosition % 8);
+  drawGlyph(fontFamily.getData(style), glyph, *x + glyph->left, *y - glyph->top, false, pixelState);
 
-          if ((byte >> bit_index) & 1) {
-            drawPixel(screenX, screenY, pixelState);
-          }
-        }
-      }
-    }
+  *x += glyph->advanceX;
+}
+
+void GfxRenderer::drawGlyph(const EpdFontData* fontData, const EpdGlyph* glyph, const int x, const int y,
+                            const bool rotated90CW, const bool pixelState) const {
+  uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  if (!frameBuffer) {
+    Serial.printf("[%lu] [GFX] !! No framebuffer\n", millis());
+    return;
+  }
+  if (glyph->width == 0 || glyph->height == 0) {
+    return;
   }
 
-  *x += glyph->advanceX;
+  int panelX = 0;
+  int panelY = 0;
+  rotateCoordinates(x, y, &panelX, &panelY);
+  // Turning the text a quarter clockwise lays its glyphs out like the next orientation round does
+  const int axes = rotated90CW ? (orientation + 1) % 4 : orientation;
+  if (renderMode == BW &&
+      blitCachedGlyph(glyphCache, frameBuffer, fontData, glyph, axes, panelX, panelY, pixelState)) {
+    return;
+  }
+  const GlyphBlitter* blitters =
+      fontData->is2Bit ? blittersForDepth<true>[renderMode] : blittersForDepth<false>[renderMode];
+  blitters[axes](frameBuffer, grayMsbPlane, &fontData->bitmap[glyph->dataOffset], glyph->width, glyph->height, panelX,
+                 panelY, pixelState);
 }
 
 void GfxRenderer::getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const {
@@ -6,10 +6,13 @@
 #include <map>
 
 #include "Bitmap.h"
+#include "GlyphCache.h"
 
 class GfxRenderer {
  public:
-  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB };
+  // GRAYSCALE draws both gray planes in one pass: the LSB plane into the framebuffer and the MSB plane into a
+  // separate buffer, see beginGrayscale
+  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB, GRAYSCALE };
 
   // Logical screen orientation from the perspective of callers
   enum Orientation {
@@ -20,24 +23,40 @@ class GfxRenderer {
   };
 
  private:
-  static constexpr size_t BW_BUFFER_CHUNK_SIZE = 8000;  // 8KB chunks to allow for non-contiguous memory
-  static constexpr size_t BW_BUFFER_NUM_CHUNKS = EInkDisplay::BUFFER_SIZE / BW_BUFFER_CHUNK_SIZE;
-  static_assert(BW_BUFFER_CHUNK_SIZE * BW_BUFFER_NUM_CHUNKS == EInkDisplay::BUFFER_SIZE,
-                "BW buffer chunking does not line up with display buffer size");
-
   EInkDisplay& einkDisplay;
   RenderMode renderMode;
   Orientation orientation;
-  uint8_t* bwBufferChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};
+  // MSB plane of a GRAYSCALE render, only allocated between beginGrayscale and copyGrayscaleBuffers
+  uint8_t* grayMsbPlane = nullptr;
   std::map<int, EpdFontFamily> fontMap;
+  mutable GlyphCache glyphCache;
+  // Per panel row and per panel byte column signatures of the frame the panel is showing, flush() compares the frame
+  // buffer against them to find the region that changed
+  mutable uint32_t shownRowSignatures[EInkDisplay::DISPLAY_HEIGHT] = {};
+  mutable uint32_t shownColumnSignatures[EInkDisplay::DISPLAY_WIDTH_BYTES] = {};
+  mutable bool shownSignaturesValid = false;
   void renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, const int* y, bool pixelState,
                   EpdFontFamily::Style style) const;
-  void freeBwBufferChunks();
+  // Draws a glyph with its top left bitmap pixel at logical (x, y), optionally turned a quarter clockwise
+  void drawGlyph(const EpdFontData* fontData, const EpdGlyph* glyph, int x, int y, bool rotated90CW,
+                 bool pixelState) const;
+  void freeGrayMsbPlane();
+  // Sets or clears the bit of logical pixel (x, y) in a panel sized buffer
+  void drawPixelInto(uint8_t* buffer, int x, int y, bool state) const;
   void rotateCoordinates(int x, int y, int* rotatedX, int* rotatedY) const;
+  // Panel pixel bounds of a logical rectangle clipped to the panel, false if nothing of it is on the panel
+  bool rotateRect(int x, int y, int width, int height, int* panelLeft, int* panelTop, int* panelRight,
+                  int* panelBottom) const;
+  static constexpr int MAX_CORNER_RADIUS = 32;
+  // How far each of the top radius rows of a rounded corner starts in from the side
+  static void cornerInsets(int radius, int* insets);
+  // Signs the frame buffer into the shown signatures and returns the panel rows and byte columns that differ from
+  // what was there. Returns false if nothing changed
+  bool updateShownSignatures(int* firstRow, int* lastRow, int* firstColumn, int* lastColumn) const;
 
  public:
   explicit GfxRenderer(EInkDisplay& einkDisplay) : einkDisplay(einkDisplay), renderMode(BW), orientation(Portrait) {}
-  ~GfxRenderer() { freeBwBufferChunks(); }
+  ~GfxRenderer() { freeGrayMsbPlane(); }
 
   static constexpr int VIEWABLE_MARGIN_TOP = 9;
   static constexpr int VIEWABLE_MARGIN_RIGHT = 3;
@@ -46,6 +65,8 @@ class GfxRenderer {
 
   // Setup
   void insertFont(int fontId, EpdFontFamily font);
+  // Resolves a font id once, callers measuring many strings in the same font should hold on to the result
+  const EpdFontFamily* getFontFamily(int fontId) const;
 
   // Orientation control (affects logical width/height and coordinate transforms)
   void setOrientation(const Orientation o) { orientation = o; }
@@ -55,8 +76,11 @@ class GfxRenderer {
   int getScreenWidth() const;
   int getScreenHeight() const;
   void displayBuffer(EInkDisplay::RefreshMode refreshMode = EInkDisplay::FAST_REFRESH) const;
-  // EXPERIMENTAL: Windowed update - display only a rectangular region
+  // Windowed update - display only a rectangular region, in logical coordinates
   void displayWindow(int x, int y, int width, int height) const;
+  // Displays whatever changed since the last frame sent to the panel. A small change is refreshed through a window
+  // around it, a large one (or a half/full refresh request) goes through displayBuffer, no change skips the refresh
+  void flush(EInkDisplay::RefreshMode refreshMode = EInkDisplay::FAST_REFRESH) const;
   void invertScreen() const;
   void clearScreen(uint8_t color = 0xFF) const;
 
@@ -65,9 +89,21 @@ class GfxRenderer {
   void drawLine(int x1, int y1, int x2, int y2, bool state = true) const;
   void drawRect(int x, int y, int width, int height, bool state = true) const;
   void fillRect(int x, int y, int width, int height, bool state = true) const;
+  // Radius is capped at half the shorter side and at MAX_CORNER_RADIUS
+  void drawRoundedRect(int x, int y, int width, int height, int radius, bool state = true) const;
+  void fillRoundedRect(int x, int y, int width, int height, int radius, bool state = true) const;
+  // Region level counterparts of clearScreen and invertScreen
+  void clearRect(int x, int y, int width, int height) const;
+  void invertRect(int x, int y, int width, int height) const;
   void drawImage(const uint8_t bitmap[], int x, int y, int width, int height) const;
   void drawBitmap(const Bitmap& bitmap, int x, int y, int maxWidth, int maxHeight, float cropX = 0,
                   float cropY = 0) const;
+  // Page images as XTC stores them, drawn from the top left of the screen. Rows: 1 bit per pixel, rows of MSB first
+  // bytes, 1 = white. Column planes: two 1 bit planes stored column by column from the right edge, 8 pixels down per
+  // byte, pixel value (plane1 bit << 1) | plane2 bit with 0 = white and 3 = black, drawn for the current render mode.
+  // Portrait pages with whole bytes per row and column are written straight into the frame buffer a byte at a time
+  void drawPackedRows(const uint8_t* bits, int width, int height) const;
+  void drawColumnPlanes(const uint8_t* plane1, const uint8_t* plane2, int width, int height) const;
 
   // Text
   int getTextWidth(int fontId, const char* text, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
@@ -78,8 +114,14 @@ class GfxRenderer {
   int getSpaceWidth(int fontId) const;
   int getFontAscenderSize(int fontId) const;
   int getLineHeight(int fontId) const;
+  // Measures the text in a single pass and returns how many bytes of it fit within maxWidth. When the text does not
+  // fit completely the cut leaves room for the ellipsis. The width of the fitted text (ellipsis included) goes to
+  // fitWidth
+  size_t fitText(int fontId, const char* text, int maxWidth, const char* ellipsis = "...",
+                 EpdFontFamily::Style style = EpdFontFamily::REGULAR, int* fitWidth = nullptr) const;
+  // The text cut down with fitText, with the ellipsis appended if anything was cut
   std::string truncatedText(int fontId, const char* text, int maxWidth,
-                            EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+                            EpdFontFamily::Style style = EpdFontFamily::REGULAR, int* textWidth = nullptr) const;
 
   // UI Components
   void drawButtonHints(int fontId, const char* btn1, const char* btn2, const char* btn3, const char* btn4) const;
@@ -97,8 +139,11 @@ class GfxRenderer {
   void copyGrayscaleLsbBuffers() const;
   void copyGrayscaleMsbBuffers() const;
   void displayGrayBuffer() const;
-  bool storeBwBuffer();  // Returns true if buffer was stored successfully
-  void restoreBwBuffer();
+  // Clears both gray planes and switches to GRAYSCALE. Returns false, leaving the mode alone, when the 48KB MSB plane
+  // can't be allocated; the caller then falls back to separate GRAYSCALE_LSB and GRAYSCALE_MSB passes
+  bool beginGrayscale();
+  // Hands both planes of a GRAYSCALE render to the display, frees the MSB plane and goes back to BW
+  void copyGrayscaleBuffers();
   void cleanupGrayscaleWithFrameBuffer() const;
 
   // Low level functions
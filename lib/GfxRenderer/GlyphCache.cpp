@@ -0,0 +1,76 @@
+#include "GlyphCache.h"
+
+#include <HardwareSerial.h>
+
+#include <cstdlib>
+#include <cstring>
+
+GlyphCache::~GlyphCache() {
+  free(slots);
+  free(arena);
+}
+
+size_t GlyphCache::slotFor(const EpdGlyph* glyph, const uint8_t axes) {
+  const auto key = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(glyph) >> 2) ^ axes;
+  return (key * 2654435761u) >> 24 & (SLOT_COUNT - 1);
+}
+
+const uint8_t* GlyphCache::find(const EpdGlyph* glyph, const uint8_t axes) const {
+  if (!slots) {
+    return nullptr;
+  }
+
+  for (size_t slot = slotFor(glyph, axes);; slot = (slot + 1) & (SLOT_COUNT - 1)) {
+    const Entry& entry = slots[slot];
+    if (!entry.glyph) {
+      return nullptr;
+    }
+    if (entry.glyph == glyph && entry.axes == axes) {
+      return arena + entry.offset;
+    }
+  }
+}
+
+uint8_t* GlyphCache::insert(const EpdGlyph* glyph, const uint8_t axes, const int rows, const int rowBytes) {
+  const size_t size = static_cast<size_t>(rows) * rowBytes;
+  if (size > ARENA_SIZE / 8) {
+    return nullptr;
+  }
+
+  if (!slots) {
+    slots = static_cast<Entry*>(calloc(SLOT_COUNT, sizeof(Entry)));
+    arena = static_cast<uint8_t*>(malloc(ARENA_SIZE));
+    if (!slots || !arena) {
+      Serial.printf("[%lu] [GFX] !! Failed to allocate glyph cache\n", millis());
+      free(slots);
+      free(arena);
+      slots = nullptr;
+      arena = nullptr;
+      return nullptr;
+    }
+  }
+
+  if (arenaUsed + size > ARENA_SIZE || entryCount >= MAX_ENTRIES) {
+    clear();
+  }
+
+  size_t slot = slotFor(glyph, axes);
+  while (slots[slot].glyph) {
+    slot = (slot + 1) & (SLOT_COUNT - 1);
+  }
+
+  slots[slot] = {glyph, static_cast<uint16_t>(arenaUsed), axes};
+  uint8_t* bits = arena + arenaUsed;
+  memset(bits, 0, size);
+  arenaUsed += size;
+  entryCount++;
+  return bits;
+}
+
+void GlyphCache::clear() {
+  if (slots) {
+    memset(slots, 0, SLOT_COUNT * sizeof(Entry));
+  }
+  arenaUsed = 0;
+  entryCount = 0;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <EpdFontData.h>
+
+#include <cstddef>
+
+// Glyph bitmaps unpacked for the BW pass as one bit row per panel row the glyph covers, leftmost panel pixel first.
+// Drawing a cached glyph is then a few shifted byte writes per panel row in any orientation, instead of walking the
+// glyph bitmap across the panel's rows in portrait. Entries share one fixed arena that is emptied when it fills up
+class GlyphCache {
+ public:
+  GlyphCache() = default;
+  GlyphCache(const GlyphCache&) = delete;
+  GlyphCache& operator=(const GlyphCache&) = delete;
+  ~GlyphCache();
+
+  // Bits of the glyph laid out with the given axes, nullptr on a miss
+  const uint8_t* find(const EpdGlyph* glyph, uint8_t axes) const;
+  // Reserves zeroed space for rows * rowBytes bits of a new entry, nullptr if it cannot be cached
+  uint8_t* insert(const EpdGlyph* glyph, uint8_t axes, int rows, int rowBytes);
+  void clear();
+
+ private:
+  static constexpr size_t SLOT_COUNT = 256;
+  // Entries beyond this share too many probe chains, the cache starts over instead
+  static constexpr size_t MAX_ENTRIES = SLOT_COUNT * 3 / 4;
+  static constexpr size_t ARENA_SIZE = 12 * 1024;
+
+  struct Entry {
+    const EpdGlyph* glyph;
+    uint16_t offset;
+    uint8_t axes;
+  };
+
+  Entry* slots = nullptr;
+  uint8_t* arena = nullptr;
+  size_t arenaUsed = 0;
+  size_t entryCount = 0;
+
+  static size_t slotFor(const EpdGlyph* glyph, uint8_t axes);
+};
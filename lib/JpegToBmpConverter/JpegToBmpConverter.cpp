@@ -15,6 +15,12 @@ struct JpegReadContext {
   size_t bufferFilled;
 };
 
+// Context for reading the JPEG from anything other than a file, e.g. straight out of the EPUB
+struct JpegSourceContext {
+  JpegToBmpConverter::ReadFn read;
+  void* source;
+};
+
 // ============================================================================
 // IMAGE PROCESSING OPTIONS - Toggle these to test different configurations
 // ============================================================================
@@ -34,6 +40,11 @@ constexpr int TARGET_MAX_WIDTH = 480;   // Max width for cover images (portrait
 constexpr int TARGET_MAX_HEIGHT = 800;  // Max height for cover images (portrait display height)
 // ============================================================================
 
+// Safety limits to prevent memory issues on ESP32
+constexpr int MAX_IMAGE_WIDTH = 2048;
+constexpr int MAX_IMAGE_HEIGHT = 3072;
+constexpr int MAX_MCU_ROW_BYTES = 65536;
+
 // Integer approximation of gamma correction (brightens midtones)
 // Uses a simple curve: out = 255 * sqrt(in/255) ≈ sqrt(in * 255)
 static inline int applyGamma(int gray) {
@@ -427,8 +438,74 @@ unsigned char JpegToBmpConverter::jpegReadCallback(unsigned char* pBuf, const un
   return 0;  // Success
 }
 
-// Core function: Convert JPEG file to 2-bit BMP
+unsigned char JpegToBmpConverter::sourceReadCallback(unsigned char* pBuf, const unsigned char buf_size,
+                                                     unsigned char* pBytes_actually_read, void* pCallback_data) {
+  const auto* context = static_cast<JpegSourceContext*>(pCallback_data);
+  // Running out of bytes is fine, picojpeg feeds itself EOI markers from there
+  *pBytes_actually_read = static_cast<unsigned char>(context->read(pBuf, buf_size, context->source));
+  return 0;
+}
+
+// Output size for a width x height image, returns true if it has to be scaled down to get there
+bool JpegToBmpConverter::scaledSize(const int width, const int height, const int targetWidth, const int targetHeight,
+                                    const bool fitWithin, int* outWidth, int* outHeight) {
+  *outWidth = width;
+  *outHeight = height;
+  if (!USE_PRESCALE || (width <= targetWidth && height <= targetHeight)) {
+    return false;
+  }
+
+  // Calculate scale to fit within target dimensions while maintaining aspect ratio
+  const float scaleToFitWidth = static_cast<float>(targetWidth) / width;
+  const float scaleToFitHeight = static_cast<float>(targetHeight) / height;
+  // Covers scale to the smaller dimension, so we can potentially crop later.
+  // TODO: ideally, we already crop here.
+  const float coverScale = (scaleToFitWidth > scaleToFitHeight) ? scaleToFitWidth : scaleToFitHeight;
+  const float withinScale = (scaleToFitWidth < scaleToFitHeight) ? scaleToFitWidth : scaleToFitHeight;
+  const float scale = fitWithin ? withinScale : coverScale;
+
+  *outWidth = static_cast<int>(width * scale);
+  *outHeight = static_cast<int>(height * scale);
+
+  // Ensure at least 1 pixel
+  if (*outWidth < 1) *outWidth = 1;
+  if (*outHeight < 1) *outHeight = 1;
+  return true;
+}
+
+bool JpegToBmpConverter::jpegSizeWithin(const ReadFn read, void* source, const int maxWidth, const int maxHeight,
+                                        int* width, int* height) {
+  // Decode init stops after the frame and scan headers and rejects what the decoder can't handle (e.g. progressive)
+  JpegSourceContext context = {read, source};
+  pjpeg_image_info_t imageInfo;
+  const unsigned char status = pjpeg_decode_init(&imageInfo, sourceReadCallback, &context, 0);
+  if (status != 0) {
+    Serial.printf("[%lu] [JPG] JPEG decode init failed with error code: %d\n", millis(), status);
+    return false;
+  }
+
+  if (imageInfo.m_width > MAX_IMAGE_WIDTH || imageInfo.m_height > MAX_IMAGE_HEIGHT) {
+    Serial.printf("[%lu] [JPG] Image too large (%dx%d), max supported: %dx%d\n", millis(), imageInfo.m_width,
+                  imageInfo.m_height, MAX_IMAGE_WIDTH, MAX_IMAGE_HEIGHT);
+    return false;
+  }
+
+  scaledSize(imageInfo.m_width, imageInfo.m_height, maxWidth, maxHeight, true, width, height);
+  return true;
+}
+
 bool JpegToBmpConverter::jpegFileToBmpStream(FsFile& jpegFile, Print& bmpOut) {
+  return convert(jpegFile, bmpOut, TARGET_MAX_WIDTH, TARGET_MAX_HEIGHT, false);
+}
+
+bool JpegToBmpConverter::jpegFileToBmpStreamWithin(FsFile& jpegFile, Print& bmpOut, const int maxWidth,
+                                                   const int maxHeight) {
+  return convert(jpegFile, bmpOut, maxWidth, maxHeight, true);
+}
+
+// Core function: Convert JPEG file to 2-bit BMP
+bool JpegToBmpConverter::convert(FsFile& jpegFile, Print& bmpOut, const int targetWidth, const int targetHeight,
+                                 const bool fitWithin) {
   Serial.printf("[%lu] [JPG] Converting JPEG to BMP\n", millis());
 
   // Setup context for picojpeg callback
@@ -445,11 +522,6 @@ bool JpegToBmpConverter::jpegFileToBmpStream(FsFile& jpegFile, Print& bmpOut) {
   Serial.printf("[%lu] [JPG] JPEG dimensions: %dx%d, components: %d, MCUs: %dx%d\n", millis(), imageInfo.m_width,
                 imageInfo.m_height, imageInfo.m_comps, imageInfo.m_MCUSPerRow, imageInfo.m_MCUSPerCol);
 
-  // Safety limits to prevent memory issues on ESP32
-  constexpr int MAX_IMAGE_WIDTH = 2048;
-  constexpr int MAX_IMAGE_HEIGHT = 3072;
-  constexpr int MAX_MCU_ROW_BYTES = 65536;
-
   if (imageInfo.m_width > MAX_IMAGE_WIDTH || imageInfo.m_height > MAX_IMAGE_HEIGHT) {
     Serial.printf("[%lu] [JPG] Image too large (%dx%d), max supported: %dx%d\n", millis(), imageInfo.m_width,
                   imageInfo.m_height, MAX_IMAGE_WIDTH, MAX_IMAGE_HEIGHT);
@@ -457,36 +529,22 @@ bool JpegToBmpConverter::jpegFileToBmpStream(FsFile& jpegFile, Print& bmpOut) {
   }
 
   // Calculate output dimensions (pre-scale to fit display exactly)
-  int outWidth = imageInfo.m_width;
-  int outHeight = imageInfo.m_height;
+  int outWidth;
+  int outHeight;
   // Use fixed-point scaling (16.16) for sub-pixel accuracy
   uint32_t scaleX_fp = 65536;  // 1.0 in 16.16 fixed point
   uint32_t scaleY_fp = 65536;
-  bool needsScaling = false;
-
-  if (USE_PRESCALE && (imageInfo.m_width > TARGET_MAX_WIDTH || imageInfo.m_height > TARGET_MAX_HEIGHT)) {
-    // Calculate scale to fit within target dimensions while maintaining aspect ratio
-    const float scaleToFitWidth = static_cast<float>(TARGET_MAX_WIDTH) / imageInfo.m_width;
-    const float scaleToFitHeight = static_cast<float>(TARGET_MAX_HEIGHT) / imageInfo.m_height;
-    // We scale to the smaller dimension, so we can potentially crop later.
-    // TODO: ideally, we already crop here.
-    const float scale = (scaleToFitWidth > scaleToFitHeight) ? scaleToFitWidth : scaleToFitHeight;
-
-    outWidth = static_cast<int>(imageInfo.m_width * scale);
-    outHeight = static_cast<int>(imageInfo.m_height * scale);
-
-    // Ensure at least 1 pixel
-    if (outWidth < 1) outWidth = 1;
-    if (outHeight < 1) outHeight = 1;
+  const bool needsScaling =
+      scaledSize(imageInfo.m_width, imageInfo.m_height, targetWidth, targetHeight, fitWithin, &outWidth, &outHeight);
 
+  if (needsScaling) {
     // Calculate fixed-point scale factors (source pixels per output pixel)
     // scaleX_fp = (srcWidth << 16) / outWidth
     scaleX_fp = (static_cast<uint32_t>(imageInfo.m_width) << 16) / outWidth;
     scaleY_fp = (static_cast<uint32_t>(imageInfo.m_height) << 16) / outHeight;
-    needsScaling = true;
 
     Serial.printf("[%lu] [JPG] Pre-scaling %dx%d -> %dx%d (fit to %dx%d)\n", millis(), imageInfo.m_width,
-                  imageInfo.m_height, outWidth, outHeight, TARGET_MAX_WIDTH, TARGET_MAX_HEIGHT);
+                  imageInfo.m_height, outWidth, outHeight, targetWidth, targetHeight);
   }
 
   // Write BMP header with output dimensions
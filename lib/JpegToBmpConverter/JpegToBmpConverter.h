@@ -1,15 +1,33 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 class FsFile;
 class Print;
 class ZipFile;
 
 class JpegToBmpConverter {
+ public:
+  // Fills buf with up to len bytes of the JPEG, returns 0 at its end
+  using ReadFn = size_t (*)(uint8_t* buf, size_t len, void* source);
+
+ private:
   static void writeBmpHeader(Print& bmpOut, int width, int height);
   // [COMMENTED OUT] static uint8_t grayscaleTo2Bit(uint8_t grayscale, int x, int y);
   static unsigned char jpegReadCallback(unsigned char* pBuf, unsigned char buf_size,
                                         unsigned char* pBytes_actually_read, void* pCallback_data);
+  static unsigned char sourceReadCallback(unsigned char* pBuf, unsigned char buf_size,
+                                          unsigned char* pBytes_actually_read, void* pCallback_data);
+  static bool scaledSize(int width, int height, int targetWidth, int targetHeight, bool fitWithin, int* outWidth,
+                         int* outHeight);
+  static bool convert(FsFile& jpegFile, Print& bmpOut, int targetWidth, int targetHeight, bool fitWithin);
 
  public:
   static bool jpegFileToBmpStream(FsFile& jpegFile, Print& bmpOut);
+  // Scales the image down to fit within maxWidth x maxHeight, smaller images keep their size
+  static bool jpegFileToBmpStreamWithin(FsFile& jpegFile, Print& bmpOut, int maxWidth, int maxHeight);
+  // Reads the JPEG only up to its frame header and gives the size jpegFileToBmpStreamWithin would produce, false for
+  // images it could not convert
+  static bool jpegSizeWithin(ReadFn read, void* source, int maxWidth, int maxHeight, int* width, int* height);
 };
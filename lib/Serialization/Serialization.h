@@ -2,6 +2,7 @@
 #include <SdFat.h>
 
 #include <iostream>
+#include <vector>
 
 namespace serialization {
 template <typename T>
@@ -49,4 +50,70 @@ static void readString(FsFile& file, std::string& s) {
   s.resize(len);
   file.read(&s[0], len);
 }
+
+// LEB128 varints for records that are built up in memory and written with a single write()
+static void writeVarint(std::vector<uint8_t>& out, uint32_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+static void writeSignedVarint(std::vector<uint8_t>& out, int32_t value) {
+  while (true) {
+    const uint8_t byte = value & 0x7F;
+    value >>= 7;
+    if ((value == 0 && !(byte & 0x40)) || (value == -1 && (byte & 0x40))) {
+      out.push_back(byte);
+      return;
+    }
+    out.push_back(byte | 0x80);
+  }
+}
+
+// Cursor over a record read into memory, reading past the end yields zeroes and clears ok
+struct BufferReader {
+  const uint8_t* pos;
+  const uint8_t* end;
+  bool ok = true;
+
+  BufferReader(const uint8_t* data, const size_t size) : pos(data), end(data + size) {}
+
+  uint8_t readByte() {
+    if (pos >= end) {
+      ok = false;
+      return 0;
+    }
+    return *pos++;
+  }
+
+  uint32_t readVarint() {
+    uint32_t value = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+      const uint8_t byte = readByte();
+      value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+      if (!(byte & 0x80)) {
+        return value;
+      }
+    }
+    ok = false;
+    return 0;
+  }
+
+  int32_t readSignedVarint() {
+    uint32_t value = 0;
+    int shift = 0;
+    uint8_t byte;
+    do {
+      byte = readByte();
+      value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+      shift += 7;
+    } while ((byte & 0x80) && shift < 35);
+    if (shift < 32 && (byte & 0x40)) {
+      value |= ~0u << shift;
+    }
+    return static_cast<int32_t>(value);
+  }
+};
 }  // namespace serialization
@@ -11,12 +11,101 @@
 #include <HardwareSerial.h>
 #include <SDCardManager.h>
 
+#include <algorithm>
 #include <cstring>
 
 namespace xtc {
 
+namespace {
+// Streams a PackBits coded bitmap out of the file through a small caller owned input buffer. Runs and literals may
+// straddle read() calls, so the decoder keeps whatever is left of the current one
+class PackBitsReader {
+  FsFile& file;
+  size_t remaining;
+  uint8_t* input;
+  size_t inputSize;
+  size_t inputPos = 0;
+  size_t inputLength = 0;
+  size_t literalLeft = 0;
+  size_t runLeft = 0;
+  uint8_t runByte = 0;
+  bool readFailed = false;
+
+  bool refill() {
+    if (remaining == 0) {
+      return false;
+    }
+    const size_t toRead = std::min(remaining, inputSize);
+    inputLength = file.read(input, toRead);
+    inputPos = 0;
+    if (inputLength != toRead) {
+      readFailed = true;
+      return false;
+    }
+    remaining -= inputLength;
+    return true;
+  }
+
+  bool nextByte(uint8_t* value) {
+    if (inputPos == inputLength && !refill()) {
+      return false;
+    }
+    *value = input[inputPos++];
+    return true;
+  }
+
+ public:
+  PackBitsReader(FsFile& file, const size_t codedSize, uint8_t* input, const size_t inputSize)
+      : file(file), remaining(codedSize), input(input), inputSize(inputSize) {}
+
+  // Decodes up to size bytes into out and returns how many were written, fewer only if the coded data runs out
+  size_t read(uint8_t* out, const size_t size) {
+    size_t written = 0;
+    while (written < size) {
+      if (runLeft > 0) {
+        const size_t count = std::min(runLeft, size - written);
+        memset(out + written, runByte, count);
+        runLeft -= count;
+        written += count;
+        continue;
+      }
+
+      if (literalLeft > 0) {
+        if (inputPos == inputLength && !refill()) {
+          break;
+        }
+        const size_t count = std::min({literalLeft, size - written, inputLength - inputPos});
+        memcpy(out + written, input + inputPos, count);
+        inputPos += count;
+        literalLeft -= count;
+        written += count;
+        continue;
+      }
+
+      uint8_t control;
+      if (!nextByte(&control)) {
+        break;
+      }
+      if (control < 128) {
+        literalLeft = control + 1;
+      } else if (control > 128) {
+        if (!nextByte(&runByte)) {
+          break;
+        }
+        runLeft = 257 - control;
+      }
+    }
+    return written;
+  }
+
+  bool failed() const { return readFailed; }
+};
+}  // namespace
+
 XtcParser::XtcParser()
     : m_isOpen(false),
+      m_pageTableWindowStart(0),
+      m_pageTableWindowCount(0),
       m_defaultWidth(DISPLAY_WIDTH),
       m_defaultHeight(DISPLAY_HEIGHT),
       m_bitDepth(1),
@@ -77,7 +166,8 @@ void XtcParser::close() {
     m_file.close();
     m_isOpen = false;
   }
-  m_pageTable.clear();
+  m_pageTableWindowStart = 0;
+  m_pageTableWindowCount = 0;
   m_chapters.clear();
   m_title.clear();
   m_hasChapters = false;
@@ -104,8 +194,8 @@ XtcError XtcParser::readHeader() {
   // Check version
   // Currently, version 1.0 is the only valid version, however some generators are swapping the bytes around, so we
   // accept both 1.0 and 0.1 for compatibility
-  const bool validVersion = m_header.versionMajor == 1 && m_header.versionMinor == 0 ||
-                            m_header.versionMajor == 0 && m_header.versionMinor == 1;
+  const bool validVersion = (m_header.versionMajor == 1 && m_header.versionMinor == 0) ||
+                            (m_header.versionMajor == 0 && m_header.versionMinor == 1);
   if (!validVersion) {
     Serial.printf("[%lu] [XTC] Unsupported version: %u.%u\n", millis(), m_header.versionMajor, m_header.versionMinor);
     return XtcError::INVALID_VERSION;
@@ -148,37 +238,22 @@ XtcError XtcParser::readPageTable() {
     return XtcError::CORRUPTED_HEADER;
   }
 
-  // Seek to page table
-  if (!m_file.seek(m_header.pageTableOffset)) {
-    Serial.printf("[%lu] [XTC] Failed to seek to page table at %llu\n", millis(), m_header.pageTableOffset);
-    return XtcError::READ_ERROR;
+  // Entries are read on demand, only check that the whole table is there
+  const uint64_t tableSize = static_cast<uint64_t>(m_header.pageCount) * sizeof(PageTableEntry);
+  if (m_header.pageTableOffset + tableSize > m_file.size()) {
+    Serial.printf("[%lu] [XTC] Page table at %llu runs past the end of the file\n", millis(), m_header.pageTableOffset);
+    return XtcError::CORRUPTED_HEADER;
   }
 
-  m_pageTable.resize(m_header.pageCount);
-
-  // Read page table entries
-  for (uint16_t i = 0; i < m_header.pageCount; i++) {
-    PageTableEntry entry;
-    size_t bytesRead = m_file.read(reinterpret_cast<uint8_t*>(&entry), sizeof(PageTableEntry));
-    if (bytesRead != sizeof(PageTableEntry)) {
-      Serial.printf("[%lu] [XTC] Failed to read page table entry %u\n", millis(), i);
-      return XtcError::READ_ERROR;
-    }
-
-    m_pageTable[i].offset = static_cast<uint32_t>(entry.dataOffset);
-    m_pageTable[i].size = entry.dataSize;
-    m_pageTable[i].width = entry.width;
-    m_pageTable[i].height = entry.height;
-    m_pageTable[i].bitDepth = m_bitDepth;
-
-    // Update default dimensions from first page
-    if (i == 0) {
-      m_defaultWidth = entry.width;
-      m_defaultHeight = entry.height;
-    }
+  // Default dimensions come from the first page
+  m_pageTableWindowCount = 0;
+  PageInfo firstPage;
+  if (!getPageInfo(0, firstPage)) {
+    return XtcError::READ_ERROR;
   }
+  m_defaultWidth = firstPage.width;
+  m_defaultHeight = firstPage.height;
 
-  Serial.printf("[%lu] [XTC] Read %u page table entries\n", millis(), m_header.pageCount);
   return XtcError::OK;
 }
 
@@ -288,61 +363,98 @@ XtcError XtcParser::readChapters() {
   return XtcError::OK;
 }
 
-bool XtcParser::getPageInfo(uint32_t pageIndex, PageInfo& info) const {
-  if (pageIndex >= m_pageTable.size()) {
+bool XtcParser::getPageInfo(const uint32_t pageIndex, PageInfo& info) const {
+  if (pageIndex >= m_header.pageCount) {
     return false;
   }
-  info = m_pageTable[pageIndex];
+
+  if (pageIndex < m_pageTableWindowStart || pageIndex >= m_pageTableWindowStart + m_pageTableWindowCount) {
+    const uint32_t start = pageIndex - pageIndex % PAGE_TABLE_WINDOW;
+    const uint32_t count = std::min<uint32_t>(PAGE_TABLE_WINDOW, m_header.pageCount - start);
+    m_pageTableWindowCount = 0;
+    if (!m_file.seek(m_header.pageTableOffset + static_cast<uint64_t>(start) * sizeof(PageTableEntry))) {
+      Serial.printf("[%lu] [XTC] Failed to seek to page table entry %u\n", millis(), start);
+      return false;
+    }
+    const size_t bytes = count * sizeof(PageTableEntry);
+    if (m_file.read(reinterpret_cast<uint8_t*>(m_pageTableWindow), bytes) != static_cast<int>(bytes)) {
+      Serial.printf("[%lu] [XTC] Failed to read page table entries %u-%u\n", millis(), start, start + count - 1);
+      return false;
+    }
+    m_pageTableWindowStart = start;
+    m_pageTableWindowCount = count;
+  }
+
+  const PageTableEntry& entry = m_pageTableWindow[pageIndex - m_pageTableWindowStart];
+  info.offset = static_cast<uint32_t>(entry.dataOffset);
+  info.size = entry.dataSize;
+  info.width = entry.width;
+  info.height = entry.height;
+  info.bitDepth = m_bitDepth;
+  info.padding = 0;
   return true;
 }
 
-size_t XtcParser::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSize) {
+XtcError XtcParser::openPage(const uint32_t pageIndex, XtgPageHeader* pageHeader, size_t* bitmapSize) {
   if (!m_isOpen) {
-    m_lastError = XtcError::FILE_NOT_FOUND;
-    return 0;
+    return XtcError::FILE_NOT_FOUND;
   }
 
   if (pageIndex >= m_header.pageCount) {
-    m_lastError = XtcError::PAGE_OUT_OF_RANGE;
-    return 0;
+    return XtcError::PAGE_OUT_OF_RANGE;
   }
 
-  const PageInfo& page = m_pageTable[pageIndex];
+  PageInfo page;
+  if (!getPageInfo(pageIndex, page)) {
+    return XtcError::READ_ERROR;
+  }
 
   // Seek to page data
   if (!m_file.seek(page.offset)) {
     Serial.printf("[%lu] [XTC] Failed to seek to page %u at offset %lu\n", millis(), pageIndex, page.offset);
-    m_lastError = XtcError::READ_ERROR;
-    return 0;
+    return XtcError::READ_ERROR;
   }
 
   // Read page header (XTG for 1-bit, XTH for 2-bit - same structure)
-  XtgPageHeader pageHeader;
-  size_t headerRead = m_file.read(reinterpret_cast<uint8_t*>(&pageHeader), sizeof(XtgPageHeader));
+  size_t headerRead = m_file.read(reinterpret_cast<uint8_t*>(pageHeader), sizeof(XtgPageHeader));
   if (headerRead != sizeof(XtgPageHeader)) {
     Serial.printf("[%lu] [XTC] Failed to read page header for page %u\n", millis(), pageIndex);
-    m_lastError = XtcError::READ_ERROR;
-    return 0;
+    return XtcError::READ_ERROR;
   }
 
   // Verify page magic (XTG for 1-bit, XTH for 2-bit)
   const uint32_t expectedMagic = (m_bitDepth == 2) ? XTH_MAGIC : XTG_MAGIC;
-  if (pageHeader.magic != expectedMagic) {
+  if (pageHeader->magic != expectedMagic) {
     Serial.printf("[%lu] [XTC] Invalid page magic for page %u: 0x%08X (expected 0x%08X)\n", millis(), pageIndex,
-                  pageHeader.magic, expectedMagic);
-    m_lastError = XtcError::INVALID_MAGIC;
-    return 0;
+                  pageHeader->magic, expectedMagic);
+    return XtcError::INVALID_MAGIC;
+  }
+
+  if (pageHeader->compression != COMPRESSION_NONE && pageHeader->compression != COMPRESSION_PACKBITS) {
+    Serial.printf("[%lu] [XTC] Unsupported compression %u for page %u\n", millis(), pageHeader->compression,
+                  pageIndex);
+    return XtcError::DECOMPRESSION_ERROR;
   }
 
   // Calculate bitmap size based on bit depth
   // XTG (1-bit): Row-major, ((width+7)/8) * height bytes
   // XTH (2-bit): Two bit planes, column-major, ((width * height + 7) / 8) * 2 bytes
-  size_t bitmapSize;
   if (m_bitDepth == 2) {
     // XTH: two bit planes, each containing (width * height) bits rounded up to bytes
-    bitmapSize = ((static_cast<size_t>(pageHeader.width) * pageHeader.height + 7) / 8) * 2;
+    *bitmapSize = ((static_cast<size_t>(pageHeader->width) * pageHeader->height + 7) / 8) * 2;
   } else {
-    bitmapSize = ((pageHeader.width + 7) / 8) * pageHeader.height;
+    *bitmapSize = ((pageHeader->width + 7) / 8) * pageHeader->height;
+  }
+  return XtcError::OK;
+}
+
+size_t XtcParser::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSize) {
+  const auto start = millis();
+  XtgPageHeader pageHeader;
+  size_t bitmapSize;
+  m_lastError = openPage(pageIndex, &pageHeader, &bitmapSize);
+  if (m_lastError != XtcError::OK) {
+    return 0;
   }
 
   // Check buffer size
@@ -352,6 +464,21 @@ size_t XtcParser::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSiz
     return 0;
   }
 
+  if (pageHeader.compression == COMPRESSION_PACKBITS) {
+    PackBitsReader reader(m_file, pageHeader.dataSize, m_packBitsInput, sizeof(m_packBitsInput));
+    const size_t decoded = reader.read(buffer, bitmapSize);
+    if (decoded != bitmapSize) {
+      Serial.printf("[%lu] [XTC] Page %u decoded to %u bytes, expected %u\n", millis(), pageIndex, decoded,
+                    bitmapSize);
+      m_lastError = reader.failed() ? XtcError::READ_ERROR : XtcError::DECOMPRESSION_ERROR;
+      return 0;
+    }
+    Serial.printf("[%lu] [XTC] Page %u: %u bytes read, %u decoded in %lums\n", millis(), pageIndex,
+                  pageHeader.dataSize, bitmapSize, millis() - start);
+    m_lastError = XtcError::OK;
+    return bitmapSize;
+  }
+
   // Read bitmap data
   size_t bytesRead = m_file.read(buffer, bitmapSize);
   if (bytesRead != bitmapSize) {
@@ -359,6 +486,7 @@ size_t XtcParser::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSiz
     m_lastError = XtcError::READ_ERROR;
     return 0;
   }
+  Serial.printf("[%lu] [XTC] Page %u: %u bytes read in %lums\n", millis(), pageIndex, bytesRead, millis() - start);
 
   m_lastError = XtcError::OK;
   return bytesRead;
@@ -367,46 +495,29 @@ size_t XtcParser::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSiz
 XtcError XtcParser::loadPageStreaming(uint32_t pageIndex,
                                       std::function<void(const uint8_t* data, size_t size, size_t offset)> callback,
                                       size_t chunkSize) {
-  if (!m_isOpen) {
-    return XtcError::FILE_NOT_FOUND;
-  }
-
-  if (pageIndex >= m_header.pageCount) {
-    return XtcError::PAGE_OUT_OF_RANGE;
-  }
-
-  const PageInfo& page = m_pageTable[pageIndex];
-
-  // Seek to page data
-  if (!m_file.seek(page.offset)) {
-    return XtcError::READ_ERROR;
-  }
-
-  // Read and skip page header (XTG for 1-bit, XTH for 2-bit)
   XtgPageHeader pageHeader;
-  size_t headerRead = m_file.read(reinterpret_cast<uint8_t*>(&pageHeader), sizeof(XtgPageHeader));
-  const uint32_t expectedMagic = (m_bitDepth == 2) ? XTH_MAGIC : XTG_MAGIC;
-  if (headerRead != sizeof(XtgPageHeader) || pageHeader.magic != expectedMagic) {
-    return XtcError::READ_ERROR;
-  }
-
-  // Calculate bitmap size based on bit depth
-  // XTG (1-bit): Row-major, ((width+7)/8) * height bytes
-  // XTH (2-bit): Two bit planes, ((width * height + 7) / 8) * 2 bytes
   size_t bitmapSize;
-  if (m_bitDepth == 2) {
-    bitmapSize = ((static_cast<size_t>(pageHeader.width) * pageHeader.height + 7) / 8) * 2;
-  } else {
-    bitmapSize = ((pageHeader.width + 7) / 8) * pageHeader.height;
+  const XtcError error = openPage(pageIndex, &pageHeader, &bitmapSize);
+  if (error != XtcError::OK) {
+    return error;
   }
 
-  // Read in chunks
+  // Read in chunks, compressed pages are handed out decoded
   std::vector<uint8_t> chunk(chunkSize);
   size_t totalRead = 0;
+  PackBitsReader reader(m_file, pageHeader.dataSize, m_packBitsInput, sizeof(m_packBitsInput));
 
   while (totalRead < bitmapSize) {
     size_t toRead = std::min(chunkSize, bitmapSize - totalRead);
-    size_t bytesRead = m_file.read(chunk.data(), toRead);
+    size_t bytesRead;
+    if (pageHeader.compression == COMPRESSION_PACKBITS) {
+      bytesRead = reader.read(chunk.data(), toRead);
+      if (bytesRead != toRead) {
+        return reader.failed() ? XtcError::READ_ERROR : XtcError::DECOMPRESSION_ERROR;
+      }
+    } else {
+      bytesRead = m_file.read(chunk.data(), toRead);
+    }
 
     if (bytesRead == 0) {
       return XtcError::READ_ERROR;
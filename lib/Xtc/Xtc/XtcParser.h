@@ -42,6 +42,7 @@ class XtcParser {
   uint8_t getBitDepth() const { return m_bitDepth; }  // 1 = XTC/XTG, 2 = XTCH/XTH
 
   // Page information
+  // Served from a small window of the page table on disk, so it may read from the file
   bool getPageInfo(uint32_t pageIndex, PageInfo& info) const;
 
   /**
@@ -80,10 +81,15 @@ class XtcParser {
   XtcError getLastError() const { return m_lastError; }
 
  private:
-  FsFile m_file;
+  // Mutable so the const lookups can fill the page table window
+  mutable FsFile m_file;
   bool m_isOpen;
   XtcHeader m_header;
-  std::vector<PageInfo> m_pageTable;
+  // Only PAGE_TABLE_WINDOW entries of the page table are held at a time, read as one block around the page asked for
+  static constexpr uint32_t PAGE_TABLE_WINDOW = 64;
+  mutable PageTableEntry m_pageTableWindow[PAGE_TABLE_WINDOW];
+  mutable uint32_t m_pageTableWindowStart;
+  mutable uint32_t m_pageTableWindowCount;
   std::vector<ChapterInfo> m_chapters;
   std::string m_title;
   uint16_t m_defaultWidth;
@@ -91,12 +97,17 @@ class XtcParser {
   uint8_t m_bitDepth;  // 1 = XTC/XTG (1-bit), 2 = XTCH/XTH (2-bit)
   bool m_hasChapters;
   XtcError m_lastError;
+  // Read buffer for PackBits pages. Kept here rather than on the stack of whichever task loads the page, the XTC
+  // reader's prefetch task only has a small one
+  uint8_t m_packBitsInput[512];
 
   // Internal helper functions
   XtcError readHeader();
   XtcError readPageTable();
   XtcError readTitle();
   XtcError readChapters();
+  // Seeks to a page and reads its header, leaving the file at the start of the stored bitmap
+  XtcError openPage(uint32_t pageIndex, XtgPageHeader* pageHeader, size_t* bitmapSize);
 };
 
 }  // namespace xtc
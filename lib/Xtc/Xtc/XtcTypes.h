@@ -68,8 +68,8 @@ struct XtgPageHeader {
   uint16_t width;       // 0x04: Image width (pixels)
   uint16_t height;      // 0x06: Image height (pixels)
   uint8_t colorMode;    // 0x08: Color mode (0=monochrome)
-  uint8_t compression;  // 0x09: Compression (0=uncompressed)
-  uint32_t dataSize;    // 0x0A: Image data size (bytes)
+  uint8_t compression;  // 0x09: Compression (0=uncompressed, 1=PackBits)
+  uint32_t dataSize;    // 0x0A: Image data size (bytes, as stored)
   uint64_t md5;         // 0x0E: MD5 checksum (first 8 bytes, optional)
   // Followed by bitmap data at offset 0x16 (22)
   //
@@ -81,9 +81,16 @@ struct XtgPageHeader {
   //   First plane: Bit1 for all pixels
   //   Second plane: Bit2 for all pixels
   //   pixelValue = (bit1 << 1) | bit2
+  //
+  // PackBits: the bitmap above run-length coded as a whole, dataSize is the coded size. Each control byte n is
+  // followed by n + 1 literal bytes (n < 128) or by one byte repeated 257 - n times (n > 128), 128 is skipped
 };
 #pragma pack(pop)
 
+// XtgPageHeader::compression values
+constexpr uint8_t COMPRESSION_NONE = 0;
+constexpr uint8_t COMPRESSION_PACKBITS = 1;
+
 // Page information (internal use, optimized for memory)
 struct PageInfo {
   uint32_t offset;   // File offset to page data (max 4GB file size)
@@ -4,6 +4,55 @@
 #include <SDCardManager.h>
 #include <miniz.h>
 
+#include <algorithm>
+
+namespace {
+constexpr uint32_t CENTRAL_DIR_SIG = 0x02014b50;
+constexpr size_t CENTRAL_DIR_HEADER_SIZE = 46;
+
+constexpr uint8_t ZIP_INDEX_VERSION = 1;
+// Buckets are sized so a lookup only has to read a handful of records
+constexpr uint16_t INDEX_TARGET_BUCKET_SIZE = 4;
+constexpr uint16_t INDEX_MAX_BUCKETS = 1024;
+// Number of records assembled in RAM at a time while building the index
+constexpr uint16_t INDEX_BUILD_WINDOW = 256;
+constexpr uint32_t FNV_OFFSET_BASIS = 2166136261u;
+
+#pragma pack(push, 1)
+struct IndexHeader {
+  uint8_t version;
+  uint32_t zipSize;
+  uint32_t centralDirOffset;
+  uint16_t totalEntries;
+  uint16_t bucketCount;
+};
+
+struct IndexRecord {
+  uint32_t nameHash;
+  uint32_t centralDirEntryOffset;
+  uint32_t compressedSize;
+  uint32_t uncompressedSize;
+  uint32_t localHeaderOffset;
+  uint16_t method;
+  uint16_t nameLen;
+};
+#pragma pack(pop)
+
+uint16_t readLe16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+
+uint32_t readLe32(const uint8_t* p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+uint32_t fnv1a(uint32_t hash, const uint8_t* data, const size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+}  // namespace
+
 bool inflateOneShot(const uint8_t* inputBuf, const size_t deflatedSize, uint8_t* outputBuf, const size_t inflatedSize) {
   // Setup inflator
   const auto inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
@@ -28,7 +77,56 @@ bool inflateOneShot(const uint8_t* inputBuf, const size_t deflatedSize, uint8_t*
   return true;
 }
 
-bool ZipFile::loadAllFileStatSlims() {
+bool ZipFile::readCentralDirEntry(FileStatSlim* fileStat, uint32_t* nameHash, uint16_t* nameLen, char* nameBuf,
+                                  const size_t nameBufSize) {
+  uint8_t header[CENTRAL_DIR_HEADER_SIZE];
+  if (file.read(header, CENTRAL_DIR_HEADER_SIZE) != CENTRAL_DIR_HEADER_SIZE) {
+    return false;
+  }
+  if (readLe32(header) != CENTRAL_DIR_SIG) return false;  // End of list
+
+  fileStat->method = readLe16(header + 10);
+  fileStat->compressedSize = readLe32(header + 20);
+  fileStat->uncompressedSize = readLe32(header + 24);
+  *nameLen = readLe16(header + 28);
+  const uint16_t extraLen = readLe16(header + 30);
+  const uint16_t commentLen = readLe16(header + 32);
+  fileStat->localHeaderOffset = readLe32(header + 42);
+
+  // Names are consumed in small chunks so arbitrarily long names can be hashed without a large buffer
+  uint32_t hash = FNV_OFFSET_BASIS;
+  uint8_t chunk[64];
+  size_t nameRead = 0;
+  while (nameRead < *nameLen) {
+    const size_t toRead = std::min(sizeof(chunk), static_cast<size_t>(*nameLen - nameRead));
+    if (file.read(chunk, toRead) != toRead) {
+      return false;
+    }
+    if (nameHash) {
+      hash = fnv1a(hash, chunk, toRead);
+    }
+    if (nameBuf && nameRead < nameBufSize - 1) {
+      memcpy(nameBuf + nameRead, chunk, std::min(toRead, nameBufSize - 1 - nameRead));
+    }
+    nameRead += toRead;
+  }
+  if (nameBuf) {
+    nameBuf[std::min(static_cast<size_t>(*nameLen), nameBufSize - 1)] = '\0';
+  }
+  if (nameHash) {
+    *nameHash = hash;
+  }
+
+  // Skip the rest of this entry (extra field + comment)
+  file.seekCur(extraLen + commentLen);
+  return true;
+}
+
+bool ZipFile::buildIndex() {
+  if (indexPath.empty()) {
+    return false;
+  }
+
   const bool wasOpen = isOpen();
   if (!wasOpen && !open()) {
     return false;
@@ -41,55 +139,224 @@ bool ZipFile::loadAllFileStatSlims() {
     return false;
   }
 
-  file.seek(zipDetails.centralDirOffset);
+  const uint32_t indexStart = millis();
 
-  uint32_t sig;
-  char itemName[256];
-  fileStatSlimCache.clear();
-  fileStatSlimCache.reserve(zipDetails.totalEntries);
+  uint16_t bucketCount = 1;
+  while (bucketCount < INDEX_MAX_BUCKETS && bucketCount * INDEX_TARGET_BUCKET_SIZE < zipDetails.totalEntries) {
+    bucketCount <<= 1;
+  }
 
-  while (file.available()) {
-    file.read(&sig, 4);
-    if (sig != 0x02014b50) break;  // End of list
+  const auto bucketStarts = static_cast<uint16_t*>(malloc((bucketCount + 1) * sizeof(uint16_t)));
+  const auto bucketFill = static_cast<uint16_t*>(malloc(bucketCount * sizeof(uint16_t)));
+  const auto window = static_cast<IndexRecord*>(malloc(INDEX_BUILD_WINDOW * sizeof(IndexRecord)));
+  FsFile indexOut;
+  bool success = bucketStarts && bucketFill && window;
+  if (!success) {
+    Serial.printf("[%lu] [ZIP] Failed to allocate memory for index build\n", millis());
+  }
+
+  // Pass 1: count how many entries land in each bucket
+  uint16_t entryCount = 0;
+  if (success) {
+    memset(bucketFill, 0, bucketCount * sizeof(uint16_t));
+    file.seek(zipDetails.centralDirOffset);
 
     FileStatSlim fileStat = {};
+    uint32_t nameHash;
+    uint16_t nameLen;
+    while (entryCount < zipDetails.totalEntries &&
+           readCentralDirEntry(&fileStat, &nameHash, &nameLen, nullptr, 0)) {
+      bucketFill[nameHash & (bucketCount - 1)]++;
+      entryCount++;
+    }
+
+    bucketStarts[0] = 0;
+    for (uint16_t i = 0; i < bucketCount; i++) {
+      bucketStarts[i + 1] = bucketStarts[i] + bucketFill[i];
+    }
+
+    success = SdMan.openFileForWrite("ZIP", indexPath, indexOut);
+  }
+
+  // Header is written with an invalid version until the index is complete
+  IndexHeader indexHeader = {0, static_cast<uint32_t>(file.size()), zipDetails.centralDirOffset, entryCount,
+                             bucketCount};
+  if (success) {
+    success = indexOut.write(reinterpret_cast<const uint8_t*>(&indexHeader), sizeof(IndexHeader)) ==
+                  sizeof(IndexHeader) &&
+              indexOut.write(reinterpret_cast<const uint8_t*>(bucketStarts), (bucketCount + 1) * sizeof(uint16_t)) ==
+                  (bucketCount + 1) * sizeof(uint16_t);
+  }
+
+  // Pass 2+: records are bucket sorted through a fixed size window, rescanning the central directory per window
+  for (uint32_t windowStart = 0; success && windowStart < entryCount; windowStart += INDEX_BUILD_WINDOW) {
+    const uint32_t windowEnd = std::min(windowStart + INDEX_BUILD_WINDOW, static_cast<uint32_t>(entryCount));
+    memset(bucketFill, 0, bucketCount * sizeof(uint16_t));
+    file.seek(zipDetails.centralDirOffset);
+
+    for (uint16_t i = 0; i < entryCount; i++) {
+      const auto entryOffset = static_cast<uint32_t>(file.position());
+      FileStatSlim fileStat = {};
+      uint32_t nameHash;
+      uint16_t nameLen;
+      if (!readCentralDirEntry(&fileStat, &nameHash, &nameLen, nullptr, 0)) {
+        success = false;
+        break;
+      }
+
+      const uint16_t bucket = nameHash & (bucketCount - 1);
+      const uint32_t slot = bucketStarts[bucket] + bucketFill[bucket]++;
+      if (slot < windowStart || slot >= windowEnd) {
+        continue;
+      }
 
-    file.seekCur(6);
-    file.read(&fileStat.method, 2);
-    file.seekCur(8);
-    file.read(&fileStat.compressedSize, 4);
-    file.read(&fileStat.uncompressedSize, 4);
-    uint16_t nameLen, m, k;
-    file.read(&nameLen, 2);
-    file.read(&m, 2);
-    file.read(&k, 2);
-    file.seekCur(8);
-    file.read(&fileStat.localHeaderOffset, 4);
-    file.read(itemName, nameLen);
-    itemName[nameLen] = '\0';
+      window[slot - windowStart] = {nameHash,
+                                    entryOffset,
+                                    fileStat.compressedSize,
+                                    fileStat.uncompressedSize,
+                                    fileStat.localHeaderOffset,
+                                    fileStat.method,
+                                    nameLen};
+    }
 
-    fileStatSlimCache.emplace(itemName, fileStat);
+    const size_t windowBytes = (windowEnd - windowStart) * sizeof(IndexRecord);
+    success = success && indexOut.write(reinterpret_cast<const uint8_t*>(window), windowBytes) == windowBytes;
+  }
 
-    // Skip the rest of this entry (extra field + comment)
-    file.seekCur(m + k);
+  if (success) {
+    indexHeader.version = ZIP_INDEX_VERSION;
+    indexOut.seek(0);
+    success = indexOut.write(reinterpret_cast<const uint8_t*>(&indexHeader), sizeof(IndexHeader)) ==
+              sizeof(IndexHeader);
   }
 
+  if (indexOut) {
+    indexOut.close();
+  }
+  free(window);
+  free(bucketFill);
+  free(bucketStarts);
   if (!wasOpen) {
     close();
   }
+
+  if (!success) {
+    Serial.printf("[%lu] [ZIP] Failed to build central directory index\n", millis());
+    SdMan.remove(indexPath.c_str());
+    return false;
+  }
+
+  // Any previously opened index handle is stale now
+  if (indexFile) {
+    indexFile.close();
+  }
+  indexState = INDEX_UNKNOWN;
+
+  Serial.printf("[%lu] [ZIP] Indexed %u entries into %u buckets in %lu ms\n", millis(), entryCount, bucketCount,
+                millis() - indexStart);
   return true;
 }
 
-bool ZipFile::loadFileStatSlim(const char* filename, FileStatSlim* fileStat) {
-  if (!fileStatSlimCache.empty()) {
-    const auto it = fileStatSlimCache.find(filename);
-    if (it != fileStatSlimCache.end()) {
-      *fileStat = it->second;
-      return true;
-    }
+bool ZipFile::openIndex() {
+  if (indexState != INDEX_UNKNOWN) {
+    return indexState == INDEX_VALID;
+  }
+
+  indexState = INDEX_UNAVAILABLE;
+  if (indexPath.empty() || !SdMan.exists(indexPath.c_str())) {
     return false;
   }
 
+  const bool wasOpen = isOpen();
+  if (!wasOpen && !open()) {
+    return false;
+  }
+  const auto zipSize = static_cast<uint32_t>(file.size());
+  if (!wasOpen) {
+    close();
+  }
+
+  if (!SdMan.openFileForRead("ZIP", indexPath, indexFile)) {
+    return false;
+  }
+
+  IndexHeader indexHeader;
+  if (indexFile.read(&indexHeader, sizeof(IndexHeader)) != sizeof(IndexHeader) ||
+      indexHeader.version != ZIP_INDEX_VERSION || indexHeader.zipSize != zipSize || indexHeader.bucketCount == 0) {
+    Serial.printf("[%lu] [ZIP] Ignoring stale or invalid central directory index\n", millis());
+    indexFile.close();
+    return false;
+  }
+
+  zipDetails = {indexHeader.centralDirOffset, indexHeader.totalEntries, true};
+  indexBucketCount = indexHeader.bucketCount;
+  indexState = INDEX_VALID;
+  return true;
+}
+
+bool ZipFile::loadIndexedFileStatSlim(const char* filename, FileStatSlim* fileStat) {
+  const size_t filenameLen = strlen(filename);
+  const uint32_t nameHash = fnv1a(FNV_OFFSET_BASIS, reinterpret_cast<const uint8_t*>(filename), filenameLen);
+  const uint16_t bucket = nameHash & (indexBucketCount - 1);
+
+  uint16_t bucketRange[2];
+  indexFile.seek(sizeof(IndexHeader) + bucket * sizeof(uint16_t));
+  if (indexFile.read(bucketRange, sizeof(bucketRange)) != sizeof(bucketRange)) {
+    return false;
+  }
+
+  const uint32_t recordsOffset = sizeof(IndexHeader) + (indexBucketCount + 1) * sizeof(uint16_t);
+  indexFile.seek(recordsOffset + bucketRange[0] * sizeof(IndexRecord));
+
+  IndexRecord records[8];
+  for (uint16_t i = bucketRange[0]; i < bucketRange[1];) {
+    const uint16_t count = std::min(static_cast<uint16_t>(bucketRange[1] - i), static_cast<uint16_t>(8));
+    if (indexFile.read(records, count * sizeof(IndexRecord)) != count * sizeof(IndexRecord)) {
+      return false;
+    }
+    i += count;
+
+    for (uint16_t j = 0; j < count; j++) {
+      const IndexRecord& record = records[j];
+      if (record.nameHash != nameHash || record.nameLen != filenameLen) {
+        continue;
+      }
+
+      // Hash matched, confirm against the name stored in the central directory
+      const bool wasOpen = isOpen();
+      if (!wasOpen && !open()) {
+        return false;
+      }
+      file.seek(record.centralDirEntryOffset + CENTRAL_DIR_HEADER_SIZE);
+      bool nameMatches = true;
+      uint8_t chunk[64];
+      for (size_t compared = 0; nameMatches && compared < filenameLen;) {
+        const size_t toRead = std::min(sizeof(chunk), filenameLen - compared);
+        nameMatches = file.read(chunk, toRead) == toRead && memcmp(chunk, filename + compared, toRead) == 0;
+        compared += toRead;
+      }
+      if (!wasOpen) {
+        close();
+      }
+
+      if (nameMatches) {
+        fileStat->method = record.method;
+        fileStat->compressedSize = record.compressedSize;
+        fileStat->uncompressedSize = record.uncompressedSize;
+        fileStat->localHeaderOffset = record.localHeaderOffset;
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+bool ZipFile::loadFileStatSlim(const char* filename, FileStatSlim* fileStat) {
+  if (openIndex()) {
+    return loadIndexedFileStatSlim(filename, fileStat);
+  }
+
   const bool wasOpen = isOpen();
   if (!wasOpen && !open()) {
     return false;
@@ -104,35 +371,16 @@ bool ZipFile::loadFileStatSlim(const char* filename, FileStatSlim* fileStat) {
 
   file.seek(zipDetails.centralDirOffset);
 
-  uint32_t sig;
   char itemName[256];
+  const size_t filenameLen = strlen(filename);
   bool found = false;
+  uint16_t nameLen;
 
-  while (file.available()) {
-    file.read(&sig, 4);
-    if (sig != 0x02014b50) break;  // End of list
-
-    file.seekCur(6);
-    file.read(&fileStat->method, 2);
-    file.seekCur(8);
-    file.read(&fileStat->compressedSize, 4);
-    file.read(&fileStat->uncompressedSize, 4);
-    uint16_t nameLen, m, k;
-    file.read(&nameLen, 2);
-    file.read(&m, 2);
-    file.read(&k, 2);
-    file.seekCur(8);
-    file.read(&fileStat->localHeaderOffset, 4);
-    file.read(itemName, nameLen);
-    itemName[nameLen] = '\0';
-
-    if (strcmp(itemName, filename) == 0) {
+  while (readCentralDirEntry(fileStat, nullptr, &nameLen, itemName, sizeof(itemName))) {
+    if (nameLen == filenameLen && strcmp(itemName, filename) == 0) {
       found = true;
       break;
     }
-
-    // Skip the rest of this entry (extra field + comment)
-    file.seekCur(m + k);
   }
 
   if (!wasOpen) {
@@ -242,6 +490,12 @@ bool ZipFile::loadZipDetails() {
   return true;
 }
 
+ZipFile::~ZipFile() {
+  if (indexFile) {
+    indexFile.close();
+  }
+}
+
 bool ZipFile::open() {
   if (!SdMan.openFileForRead("ZIP", filePath, file)) {
     return false;
@@ -362,11 +616,8 @@ uint8_t* ZipFile::readFileToMemory(const char* filename, size_t* size, const boo
   return data;
 }
 
-bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t chunkSize) {
-  const bool wasOpen = isOpen();
-  if (!wasOpen && !open()) {
-    return false;
-  }
+bool ZipFile::openEntry(const char* filename, EntryReader& reader, const size_t chunkSize) {
+  reader.close();
 
   FileStatSlim fileStat = {};
   if (!loadFileStatSlim(filename, &fileStat)) {
@@ -378,173 +629,174 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
     return false;
   }
 
-  file.seek(fileOffset);
-  const auto deflatedDataSize = fileStat.compressedSize;
-  const auto inflatedDataSize = fileStat.uncompressedSize;
+  if (fileStat.method != MZ_NO_COMPRESSION && fileStat.method != MZ_DEFLATED) {
+    Serial.printf("[%lu] [ZIP] Unsupported compression method\n", millis());
+    return false;
+  }
+
+  if (!SdMan.openFileForRead("ZIP", filePath, reader.file)) {
+    return false;
+  }
+  reader.file.seek(fileOffset);
+
+  reader.method = fileStat.method;
+  reader.compressedRemaining = fileStat.compressedSize;
+  reader.uncompressedSize = fileStat.uncompressedSize;
+  reader.chunkSize = chunkSize;
 
   if (fileStat.method == MZ_NO_COMPRESSION) {
-    // no deflation, just read content
-    const auto buffer = static_cast<uint8_t*>(malloc(chunkSize));
-    if (!buffer) {
-      Serial.printf("[%lu] [ZIP] Failed to allocate memory for buffer\n", millis());
-      if (!wasOpen) {
-        close();
-      }
+    return true;
+  }
+
+  reader.inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
+  reader.readBuffer = static_cast<uint8_t*>(malloc(chunkSize));
+  reader.dictionary = static_cast<uint8_t*>(malloc(TINFL_LZ_DICT_SIZE));
+  if (!reader.inflator || !reader.readBuffer || !reader.dictionary) {
+    Serial.printf("[%lu] [ZIP] Failed to allocate memory for entry reader\n", millis());
+    reader.close();
+    return false;
+  }
+  memset(reader.inflator, 0, sizeof(tinfl_decompressor));
+  tinfl_init(reader.inflator);
+  return true;
+}
+
+void ZipFile::EntryReader::close() {
+  if (file) {
+    file.close();
+  }
+  free(inflator);
+  free(readBuffer);
+  free(dictionary);
+  inflator = nullptr;
+  readBuffer = nullptr;
+  dictionary = nullptr;
+  method = 0;
+  compressedRemaining = 0;
+  uncompressedSize = 0;
+  uncompressedRead = 0;
+  readBufferFilled = 0;
+  readBufferCursor = 0;
+  dictionaryCursor = 0;
+  pendingStart = 0;
+  pendingLength = 0;
+  finished = false;
+  failed = false;
+}
+
+bool ZipFile::EntryReader::inflateMore() {
+  // Load more compressed bytes when needed
+  if (readBufferCursor >= readBufferFilled && compressedRemaining > 0) {
+    readBufferFilled = file.read(readBuffer, compressedRemaining < chunkSize ? compressedRemaining : chunkSize);
+    readBufferCursor = 0;
+    if (readBufferFilled == 0) {
+      Serial.printf("[%lu] [ZIP] Could not read more bytes\n", millis());
+      failed = true;
       return false;
     }
+    compressedRemaining -= readBufferFilled;
+  }
 
-    size_t remaining = inflatedDataSize;
-    while (remaining > 0) {
-      const size_t dataRead = file.read(buffer, remaining < chunkSize ? remaining : chunkSize);
-      if (dataRead == 0) {
-        Serial.printf("[%lu] [ZIP] Could not read more bytes\n", millis());
-        free(buffer);
-        if (!wasOpen) {
-          close();
-        }
-        return false;
-      }
+  // Available bytes in readBuffer to process
+  size_t inBytes = readBufferFilled - readBufferCursor;
+  // Space remaining in dictionary before it wraps
+  size_t outBytes = TINFL_LZ_DICT_SIZE - dictionaryCursor;
 
-      out.write(buffer, dataRead);
-      remaining -= dataRead;
-    }
+  const tinfl_status status =
+      tinfl_decompress(inflator, readBuffer + readBufferCursor, &inBytes, dictionary, dictionary + dictionaryCursor,
+                       &outBytes, compressedRemaining > 0 ? TINFL_FLAG_HAS_MORE_INPUT : 0);
 
-    if (!wasOpen) {
-      close();
-    }
-    free(buffer);
-    return true;
+  readBufferCursor += inBytes;
+  pendingStart = dictionaryCursor;
+  pendingLength = outBytes;
+  // Update output position in buffer (with wraparound)
+  dictionaryCursor = (dictionaryCursor + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+
+  if (status < 0) {
+    Serial.printf("[%lu] [ZIP] tinfl_decompress() failed with status %d\n", millis(), status);
+    failed = true;
+    return false;
   }
 
-  if (fileStat.method == MZ_DEFLATED) {
-    // Setup inflator
-    const auto inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
-    if (!inflator) {
-      Serial.printf("[%lu] [ZIP] Failed to allocate memory for inflator\n", millis());
-      if (!wasOpen) {
-        close();
-      }
-      return false;
+  if (status == TINFL_STATUS_DONE) {
+    finished = true;
+  } else if (outBytes == 0 && inBytes == 0 && compressedRemaining == 0) {
+    // No progress possible, input is exhausted without TINFL_STATUS_DONE
+    Serial.printf("[%lu] [ZIP] Unexpected EOF\n", millis());
+    failed = true;
+    return false;
+  }
+
+  return true;
+}
+
+size_t ZipFile::EntryReader::read(uint8_t* buf, const size_t len) {
+  if (!file || failed) {
+    return 0;
+  }
+
+  size_t total = 0;
+  if (method == MZ_NO_COMPRESSION) {
+    const size_t remaining = uncompressedSize - uncompressedRead;
+    total = file.read(buf, len < remaining ? len : remaining);
+    if (total == 0 && remaining > 0) {
+      Serial.printf("[%lu] [ZIP] Could not read more bytes\n", millis());
+      failed = true;
     }
-    memset(inflator, 0, sizeof(tinfl_decompressor));
-    tinfl_init(inflator);
-
-    // Setup file read buffer
-    const auto fileReadBuffer = static_cast<uint8_t*>(malloc(chunkSize));
-    if (!fileReadBuffer) {
-      Serial.printf("[%lu] [ZIP] Failed to allocate memory for zip file read buffer\n", millis());
-      free(inflator);
-      if (!wasOpen) {
-        close();
-      }
-      return false;
+    uncompressedRead += total;
+    return total;
+  }
+
+  while (total < len) {
+    if (pendingLength > 0) {
+      const size_t toCopy = pendingLength < len - total ? pendingLength : len - total;
+      memcpy(buf + total, dictionary + pendingStart, toCopy);
+      pendingStart += toCopy;
+      pendingLength -= toCopy;
+      total += toCopy;
+      continue;
     }
 
-    const auto outputBuffer = static_cast<uint8_t*>(malloc(TINFL_LZ_DICT_SIZE));
-    if (!outputBuffer) {
-      Serial.printf("[%lu] [ZIP] Failed to allocate memory for dictionary\n", millis());
-      free(inflator);
-      free(fileReadBuffer);
-      if (!wasOpen) {
-        close();
-      }
-      return false;
+    if (finished || !inflateMore()) {
+      break;
     }
-    memset(outputBuffer, 0, TINFL_LZ_DICT_SIZE);
-
-    size_t fileRemainingBytes = deflatedDataSize;
-    size_t processedOutputBytes = 0;
-    size_t fileReadBufferFilledBytes = 0;
-    size_t fileReadBufferCursor = 0;
-    size_t outputCursor = 0;  // Current offset in the circular dictionary
-
-    while (true) {
-      // Load more compressed bytes when needed
-      if (fileReadBufferCursor >= fileReadBufferFilledBytes) {
-        if (fileRemainingBytes == 0) {
-          // Should not be hit, but a safe protection
-          break;  // EOF
-        }
-
-        fileReadBufferFilledBytes =
-            file.read(fileReadBuffer, fileRemainingBytes < chunkSize ? fileRemainingBytes : chunkSize);
-        fileRemainingBytes -= fileReadBufferFilledBytes;
-        fileReadBufferCursor = 0;
-
-        if (fileReadBufferFilledBytes == 0) {
-          // Bad read
-          break;  // EOF
-        }
-      }
+  }
 
-      // Available bytes in fileReadBuffer to process
-      size_t inBytes = fileReadBufferFilledBytes - fileReadBufferCursor;
-      // Space remaining in outputBuffer
-      size_t outBytes = TINFL_LZ_DICT_SIZE - outputCursor;
-
-      const tinfl_status status = tinfl_decompress(inflator, fileReadBuffer + fileReadBufferCursor, &inBytes,
-                                                   outputBuffer, outputBuffer + outputCursor, &outBytes,
-                                                   fileRemainingBytes > 0 ? TINFL_FLAG_HAS_MORE_INPUT : 0);
-
-      // Update input position
-      fileReadBufferCursor += inBytes;
-
-      // Write output chunk
-      if (outBytes > 0) {
-        processedOutputBytes += outBytes;
-        if (out.write(outputBuffer + outputCursor, outBytes) != outBytes) {
-          Serial.printf("[%lu] [ZIP] Failed to write all output bytes to stream\n", millis());
-          if (!wasOpen) {
-            close();
-          }
-          free(outputBuffer);
-          free(fileReadBuffer);
-          free(inflator);
-          return false;
-        }
-        // Update output position in buffer (with wraparound)
-        outputCursor = (outputCursor + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
-      }
+  uncompressedRead += total;
+  return total;
+}
 
-      if (status < 0) {
-        Serial.printf("[%lu] [ZIP] tinfl_decompress() failed with status %d\n", millis(), status);
-        if (!wasOpen) {
-          close();
-        }
-        free(outputBuffer);
-        free(fileReadBuffer);
-        free(inflator);
-        return false;
-      }
+bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t chunkSize) {
+  EntryReader reader;
+  if (!openEntry(filename, reader, chunkSize)) {
+    return false;
+  }
 
-      if (status == TINFL_STATUS_DONE) {
-        Serial.printf("[%lu] [ZIP] Decompressed %d bytes into %d bytes\n", millis(), deflatedDataSize,
-                      inflatedDataSize);
-        if (!wasOpen) {
-          close();
-        }
-        free(inflator);
-        free(fileReadBuffer);
-        free(outputBuffer);
-        return true;
-      }
+  const auto buffer = static_cast<uint8_t*>(malloc(chunkSize));
+  if (!buffer) {
+    Serial.printf("[%lu] [ZIP] Failed to allocate memory for buffer\n", millis());
+    return false;
+  }
+
+  while (reader.available()) {
+    const size_t dataRead = reader.read(buffer, chunkSize);
+    if (dataRead == 0) {
+      break;
     }
 
-    // If we get here, EOF reached without TINFL_STATUS_DONE
-    Serial.printf("[%lu] [ZIP] Unexpected EOF\n", millis());
-    if (!wasOpen) {
-      close();
+    if (out.write(buffer, dataRead) != dataRead) {
+      Serial.printf("[%lu] [ZIP] Failed to write all output bytes to stream\n", millis());
+      free(buffer);
+      return false;
     }
-    free(outputBuffer);
-    free(fileReadBuffer);
-    free(inflator);
-    return false;
   }
+  free(buffer);
 
-  if (!wasOpen) {
-    close();
+  if (reader.hasFailed() || reader.position() != reader.size()) {
+    Serial.printf("[%lu] [ZIP] Failed to read %s\n", millis(), filename);
+    return false;
   }
 
-  Serial.printf("[%lu] [ZIP] Unsupported compression method\n", millis());
-  return false;
+  Serial.printf("[%lu] [ZIP] Streamed %s (%d bytes)\n", millis(), filename, reader.size());
+  return true;
 }
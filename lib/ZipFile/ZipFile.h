@@ -2,7 +2,8 @@
 #include <SdFat.h>
 
 #include <string>
-#include <unordered_map>
+
+struct tinfl_decompressor_tag;
 
 class ZipFile {
  public:
@@ -19,28 +20,83 @@ class ZipFile {
     bool isSet;
   };
 
+  // Pull-style reader for a single entry, inflating on demand as the caller reads
+  // Holds its own handle on the zip so it can outlive the ZipFile that opened it
+  class EntryReader {
+    friend class ZipFile;
+
+    FsFile file;
+    uint16_t method = 0;
+    uint32_t compressedRemaining = 0;
+    uint32_t uncompressedSize = 0;
+    uint32_t uncompressedRead = 0;
+    size_t chunkSize = 0;
+    tinfl_decompressor_tag* inflator = nullptr;
+    uint8_t* readBuffer = nullptr;
+    size_t readBufferFilled = 0;
+    size_t readBufferCursor = 0;
+    // Circular inflate window, inflated bytes not yet handed to the caller sit in [pendingStart, +pendingLength)
+    uint8_t* dictionary = nullptr;
+    size_t dictionaryCursor = 0;
+    size_t pendingStart = 0;
+    size_t pendingLength = 0;
+    bool finished = false;
+    bool failed = false;
+
+    bool inflateMore();
+
+   public:
+    EntryReader() = default;
+    ~EntryReader() { close(); }
+    EntryReader(const EntryReader&) = delete;
+    EntryReader& operator=(const EntryReader&) = delete;
+
+    // Reads up to len inflated bytes, returns 0 once the entry is exhausted or on error
+    size_t read(uint8_t* buf, size_t len);
+    bool available() const { return !failed && uncompressedRead < uncompressedSize; }
+    bool hasFailed() const { return failed; }
+    size_t size() const { return uncompressedSize; }
+    size_t position() const { return uncompressedRead; }
+    void close();
+  };
+
  private:
+  enum IndexState : uint8_t { INDEX_UNKNOWN, INDEX_VALID, INDEX_UNAVAILABLE };
+
   const std::string& filePath;
+  // Optional on-SD central directory index, see buildIndex()
+  std::string indexPath;
   FsFile file;
+  FsFile indexFile;
+  IndexState indexState = INDEX_UNKNOWN;
+  uint16_t indexBucketCount = 0;
   ZipDetails zipDetails = {0, 0, false};
-  std::unordered_map<std::string, FileStatSlim> fileStatSlimCache;
 
   bool loadFileStatSlim(const char* filename, FileStatSlim* fileStat);
+  bool openIndex();
+  bool loadIndexedFileStatSlim(const char* filename, FileStatSlim* fileStat);
+  bool readCentralDirEntry(FileStatSlim* fileStat, uint32_t* nameHash, uint16_t* nameLen, char* nameBuf,
+                           size_t nameBufSize);
   long getDataOffset(const FileStatSlim& fileStat);
   bool loadZipDetails();
 
  public:
-  explicit ZipFile(const std::string& filePath) : filePath(filePath) {}
-  ~ZipFile() = default;
+  explicit ZipFile(const std::string& filePath, std::string indexPath = "")
+      : filePath(filePath), indexPath(std::move(indexPath)) {}
+  ~ZipFile();
   // Zip file can be opened and closed by hand in order to allow for quick calculation of inflated file size
   // It is NOT recommended to pre-open it for any kind of inflation due to memory constraints
   bool isOpen() const { return !!file; }
   bool open();
   bool close();
-  bool loadAllFileStatSlims();
+  // Writes a hashed index of the central directory to indexPath so lookups don't need to rescan the zip
+  // Index is built using a fixed amount of RAM regardless of the number of entries in the zip
+  bool buildIndex();
   bool getInflatedFileSize(const char* filename, size_t* size);
   // Due to the memory required to run each of these, it is recommended to not preopen the zip file for multiple
   // These functions will open and close the zip as needed
   uint8_t* readFileToMemory(const char* filename, size_t* size = nullptr, bool trailingNullByte = false);
   bool readFileToStream(const char* filename, Print& out, size_t chunkSize);
+  // Opens an entry for incremental reading, chunkSize is the size of the compressed read buffer
+  bool openEntry(const char* filename, EntryReader& reader, size_t chunkSize);
 };
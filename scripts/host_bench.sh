@@ -0,0 +1,37 @@
+#!/usr/bin/env bash
+# Builds the benchmarks in test/host_bench against the libraries under lib/ and runs them on this machine.
+# The stubs in test/host_bench/stubs stand in for the Arduino core, SdFat and the display SDK.
+#
+# Usage: scripts/host_bench.sh [benchmark...]   e.g. scripts/host_bench.sh glyphs
+# Runs every test/host_bench/bench_*.cpp when no benchmark is named. CXX and CXXFLAGS are honoured, build output
+# goes to HOST_BENCH_OUT (a directory under /tmp by default).
+set -euo pipefail
+
+root="$(cd "$(dirname "$0")/.." && pwd)"
+bench_dir="$root/test/host_bench"
+out="${HOST_BENCH_OUT:-${TMPDIR:-/tmp}/crosspoint_host_bench}"
+cxx="${CXX:-g++}"
+cxxflags="${CXXFLAGS:--O2}"
+includes=(-I"$bench_dir/stubs" -I"$root/lib/EpdFont" -I"$root/lib/GfxRenderer" -I"$root/lib/Utf8"
+          -I"$root/lib/FsHelpers" -I"$root/lib/Xtc")
+sources=("$root"/lib/EpdFont/*.cpp "$root"/lib/GfxRenderer/*.cpp "$root"/lib/Utf8/*.cpp "$root"/lib/FsHelpers/*.cpp
+         "$root"/lib/Xtc/*.cpp "$root"/lib/Xtc/Xtc/*.cpp)
+
+mkdir -p "$out/obj" "$out/sd"
+
+objects=()
+for source in "${sources[@]}"; do
+  object="$out/obj/$(echo "${source#"$root"/}" | tr / _).o"
+  "$cxx" -std=c++20 $cxxflags -Wall -Wextra "${includes[@]}" -c "$source" -o "$object"
+  objects+=("$object")
+done
+
+if [ $# -eq 0 ]; then
+  set -- $(cd "$bench_dir" && ls bench_*.cpp | sed 's/^bench_//; s/\.cpp$//')
+fi
+
+for name in "$@"; do
+  echo "== $name"
+  "$cxx" -std=c++20 $cxxflags -Wall -Wextra "${includes[@]}" "$bench_dir/bench_$name.cpp" "${objects[@]}" -o "$out/bench_$name"
+  (cd "$root" && HOST_BENCH_SD="$out/sd" "$out/bench_$name")
+done
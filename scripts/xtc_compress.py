@@ -0,0 +1,118 @@
+"""Rewrites an XTC/XTCH book with PackBits coded page bitmaps.
+
+Usage: python3 scripts/xtc_compress.py input.xtc output.xtc
+
+Pages that would not get smaller are kept uncompressed. Everything in front of the first page (header, title,
+chapters, page table) is copied as is, apart from the page table entries which are pointed at the new page data.
+"""
+
+import struct
+import sys
+import time
+
+XTC_HEADER = struct.Struct("<IBBHIIIIQQQII")
+PAGE_TABLE_ENTRY = struct.Struct("<QIHH")
+PAGE_HEADER = struct.Struct("<IHHBBIQ")
+
+XTC_MAGIC = 0x00435458
+XTCH_MAGIC = 0x48435458
+COMPRESSION_NONE = 0
+COMPRESSION_PACKBITS = 1
+
+
+def packbits(data: bytes) -> bytes:
+    out = bytearray()
+    literal = bytearray()
+    i = 0
+    n = len(data)
+
+    def flush_literal():
+        for start in range(0, len(literal), 128):
+            part = literal[start:start + 128]
+            out.append(len(part) - 1)
+            out.extend(part)
+        literal.clear()
+
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and data[i + run] == data[i]:
+            run += 1
+        # A run of two only pays off when it doesn't split a literal
+        if run >= 3 or (run == 2 and not literal):
+            flush_literal()
+            out.append(257 - run)
+            out.append(data[i])
+            i += run
+        else:
+            literal.append(data[i])
+            i += 1
+    flush_literal()
+    return bytes(out)
+
+
+def bitmap_size(magic: int, width: int, height: int) -> int:
+    if magic == XTCH_MAGIC:
+        return (width * height + 7) // 8 * 2
+    return (width + 7) // 8 * height
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__.strip())
+        sys.exit(1)
+
+    with open(sys.argv[1], "rb") as f:
+        book = f.read()
+
+    header = XTC_HEADER.unpack_from(book, 0)
+    magic, page_count, page_table_offset = header[0], header[3], header[8]
+    if magic not in (XTC_MAGIC, XTCH_MAGIC):
+        sys.exit(f"{sys.argv[1]}: not an XTC/XTCH file")
+
+    entries = [PAGE_TABLE_ENTRY.unpack_from(book, page_table_offset + i * PAGE_TABLE_ENTRY.size)
+               for i in range(page_count)]
+    first_page = min(entry[0] for entry in entries)
+    if page_table_offset + page_count * PAGE_TABLE_ENTRY.size > first_page:
+        sys.exit(f"{sys.argv[1]}: page table overlaps the page data")
+
+    last_page_end = max(entry[0] + entry[1] for entry in entries)
+    if last_page_end < len(book):
+        print(f"warning: dropping {len(book) - last_page_end} bytes after the last page")
+
+    out = bytearray(book[:first_page])
+    bytes_before = 0
+    started = time.monotonic()
+    for index, (offset, entry_size, width, height) in enumerate(entries):
+        page_magic, page_width, page_height, color_mode, compression, data_size, md5 = \
+            PAGE_HEADER.unpack_from(book, offset)
+        data_start = offset + PAGE_HEADER.size
+        if compression == COMPRESSION_NONE:
+            data_size = bitmap_size(magic, page_width, page_height)
+            bitmap = book[data_start:data_start + data_size]
+            coded = packbits(bitmap)
+            if len(coded) < len(bitmap):
+                compression, payload = COMPRESSION_PACKBITS, coded
+            else:
+                payload = bitmap
+        else:
+            payload = book[data_start:data_start + data_size]
+        bytes_before += PAGE_HEADER.size + data_size
+
+        new_offset = len(out)
+        out += PAGE_HEADER.pack(page_magic, page_width, page_height, color_mode, compression, len(payload), md5)
+        out += payload
+        # Keep whatever the entry size counted on top of the bitmap (the page header, usually)
+        PAGE_TABLE_ENTRY.pack_into(out, page_table_offset + index * PAGE_TABLE_ENTRY.size, new_offset,
+                                   entry_size - data_size + len(payload), width, height)
+
+    with open(sys.argv[2], "wb") as f:
+        f.write(out)
+
+    bytes_after = len(out) - first_page
+    print(f"{page_count} pages: {bytes_before} -> {bytes_after} bytes of page data "
+          f"({bytes_after * 100 // max(bytes_before, 1)}%, {bytes_after // max(page_count, 1)} bytes per page) "
+          f"in {time.monotonic() - started:.1f}s")
+
+
+if __name__ == "__main__":
+    main()
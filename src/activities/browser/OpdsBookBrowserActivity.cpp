@@ -161,7 +161,7 @@ void OpdsBookBrowserActivity::render() const {
     renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2, statusMessage.c_str());
     const auto labels = mappedInput.mapLabels("« Back", "", "", "");
     renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
-    renderer.displayBuffer();
+    renderer.flush();
     return;
   }
 
@@ -169,7 +169,7 @@ void OpdsBookBrowserActivity::render() const {
     renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2, statusMessage.c_str());
     const auto labels = mappedInput.mapLabels("« Back", "", "", "");
     renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
-    renderer.displayBuffer();
+    renderer.flush();
     return;
   }
 
@@ -178,7 +178,7 @@ void OpdsBookBrowserActivity::render() const {
     renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2 + 10, errorMessage.c_str());
     const auto labels = mappedInput.mapLabels("« Back", "Retry", "", "");
     renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
-    renderer.displayBuffer();
+    renderer.flush();
     return;
   }
 
@@ -192,7 +192,7 @@ void OpdsBookBrowserActivity::render() const {
       const int barY = pageHeight / 2 + 20;
       ScreenComponents::drawProgressBar(renderer, barX, barY, barWidth, barHeight, downloadProgress, downloadTotal);
     }
-    renderer.displayBuffer();
+    renderer.flush();
     return;
   }
 
@@ -207,7 +207,7 @@ void OpdsBookBrowserActivity::render() const {
 
   if (entries.empty()) {
     renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2, "No entries found");
-    renderer.displayBuffer();
+    renderer.flush();
     return;
   }
 
@@ -234,7 +234,7 @@ void OpdsBookBrowserActivity::render() const {
                       i != static_cast<size_t>(selectorIndex));
   }
 
-  renderer.displayBuffer();
+  renderer.flush();
 }
 
 void OpdsBookBrowserActivity::fetchFeed(const std::string& path) {
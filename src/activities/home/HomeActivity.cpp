@@ -4,6 +4,7 @@
 #include <GfxRenderer.h>
 #include <SDCardManager.h>
 
+#include <algorithm>
 #include <cstring>
 #include <vector>
 
@@ -214,22 +215,16 @@ void HomeActivity::render() const {
       if (lines.size() >= 3) {
         // Limit to 3 lines
         // Still have words left, so add ellipsis to last line
-        lines.back().append("...");
-
-        while (!lines.back().empty() && renderer.getTextWidth(UI_12_FONT_ID, lines.back().c_str()) > maxLineWidth) {
-          lines.back().resize(lines.back().size() - 5);
-          lines.back().append("...");
-        }
+        auto& lastLine = lines.back();
+        const std::string withEllipsis = lastLine + "...";
+        lastLine.resize(std::min(lastLine.size(), renderer.fitText(UI_12_FONT_ID, withEllipsis.c_str(), maxLineWidth)));
+        lastLine.append("...");
         break;
       }
 
-      int wordWidth = renderer.getTextWidth(UI_12_FONT_ID, i.c_str());
-      while (wordWidth > maxLineWidth && i.size() > 5) {
-        // Word itself is too long, trim it
-        i.resize(i.size() - 5);
-        i.append("...");
-        wordWidth = renderer.getTextWidth(UI_12_FONT_ID, i.c_str());
-      }
+      // Word itself may be too long, trim it
+      int wordWidth;
+      i = renderer.truncatedText(UI_12_FONT_ID, i.c_str(), maxLineWidth, EpdFontFamily::REGULAR, &wordWidth);
 
       int newLineWidth = renderer.getTextWidth(UI_12_FONT_ID, currentLine.c_str());
       if (newLineWidth > 0) {
@@ -267,12 +262,8 @@ void HomeActivity::render() const {
 
     if (!lastBookAuthor.empty()) {
       titleYStart += renderer.getLineHeight(UI_10_FONT_ID) / 2;
-      std::string trimmedAuthor = lastBookAuthor;
       // Trim author if too long
-      while (renderer.getTextWidth(UI_10_FONT_ID, trimmedAuthor.c_str()) > maxLineWidth && !trimmedAuthor.empty()) {
-        trimmedAuthor.resize(trimmedAuthor.size() - 5);
-        trimmedAuthor.append("...");
-      }
+      const std::string trimmedAuthor = renderer.truncatedText(UI_10_FONT_ID, lastBookAuthor.c_str(), maxLineWidth);
       renderer.drawCenteredText(UI_10_FONT_ID, titleYStart, trimmedAuthor.c_str(), !bookSelected);
     }
 
@@ -335,5 +326,5 @@ void HomeActivity::render() const {
   const auto batteryX = pageWidth - 25 - renderer.getTextWidth(SMALL_FONT_ID, "100 %");
   ScreenComponents::drawBattery(renderer, batteryX, 10);
 
-  renderer.displayBuffer();
+  renderer.flush();
 }
@@ -723,7 +723,7 @@ void CalibreWirelessActivity::render() const {
   const auto labels = mappedInput.mapLabels("Back", "", "", "");
   renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  renderer.displayBuffer();
+  renderer.flush();
 }
 
 std::string CalibreWirelessActivity::getDeviceUuid() const {
@@ -330,12 +330,12 @@ void CrossPointWebServerActivity::render() const {
   if (state == WebServerActivityState::SERVER_RUNNING) {
     renderer.clearScreen();
     renderServerRunning();
-    renderer.displayBuffer();
+    renderer.flush();
   } else if (state == WebServerActivityState::AP_STARTING) {
     renderer.clearScreen();
     const auto pageHeight = renderer.getScreenHeight();
     renderer.drawCenteredText(UI_12_FONT_ID, pageHeight / 2 - 20, "Starting Hotspot...", true, EpdFontFamily::BOLD);
-    renderer.displayBuffer();
+    renderer.flush();
   }
 }
 
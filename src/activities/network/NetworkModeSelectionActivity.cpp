@@ -125,5 +125,5 @@ void NetworkModeSelectionActivity::render() const {
   const auto labels = mappedInput.mapLabels("« Back", "Select", "", "");
   renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  renderer.displayBuffer();
+  renderer.flush();
 }
@@ -497,7 +497,7 @@ void WifiSelectionActivity::render() const {
       break;
   }
 
-  renderer.displayBuffer();
+  renderer.flush();
 }
 
 void WifiSelectionActivity::renderNetworkList() const {
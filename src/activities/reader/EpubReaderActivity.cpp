@@ -24,6 +24,11 @@ void EpubReaderActivity::taskTrampoline(void* param) {
   self->displayTaskLoop();
 }
 
+void EpubReaderActivity::prelayoutTaskTrampoline(void* param) {
+  auto* self = static_cast<EpubReaderActivity*>(param);
+  self->prelayoutTaskLoop();
+}
+
 void EpubReaderActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
@@ -87,6 +92,14 @@ void EpubReaderActivity::onEnter() {
               1,                  // Priority
               &displayTaskHandle  // Task handle
   );
+
+  // Lays out the neighbouring chapters while the reader is idle, below the display task so it never delays a page
+  xTaskCreate(&EpubReaderActivity::prelayoutTaskTrampoline, "EpubReaderPrelayoutTask",
+              8192,                 // Stack size
+              this,                 // Parameters
+              0,                    // Priority
+              &prelayoutTaskHandle  // Task handle
+  );
 }
 
 void EpubReaderActivity::onExit() {
@@ -95,12 +108,19 @@ void EpubReaderActivity::onExit() {
   // Reset orientation back to portrait for the rest of the UI
   renderer.setOrientation(GfxRenderer::Orientation::Portrait);
 
+  // Let a background build bail out first so it doesn't leave a partial section file behind
+  stopPrelayout();
+
   // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
   if (displayTaskHandle) {
     vTaskDelete(displayTaskHandle);
     displayTaskHandle = nullptr;
   }
+  if (prelayoutTaskHandle) {
+    vTaskDelete(prelayoutTaskHandle);
+    prelayoutTaskHandle = nullptr;
+  }
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
   section.reset();
@@ -116,6 +136,8 @@ void EpubReaderActivity::loop() {
 
   // Enter chapter selection activity
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
+    // The chapter list reads the book cache too, so keep the background layout out of its way
+    stopPrelayout();
     // Don't start activity transition while rendering
     xSemaphoreTake(renderingMutex, portMAX_DELAY);
     exitActivity();
@@ -123,6 +145,7 @@ void EpubReaderActivity::loop() {
         this->renderer, this->mappedInput, epub, currentSpineIndex,
         [this] {
           exitActivity();
+          startPrelayout();
           updateRequired = true;
         },
         [this](const int newSpineIndex) {
@@ -132,6 +155,7 @@ void EpubReaderActivity::loop() {
             section.reset();
           }
           exitActivity();
+          startPrelayout();
           updateRequired = true;
         }));
     xSemaphoreGive(renderingMutex);
@@ -198,7 +222,8 @@ void EpubReaderActivity::loop() {
     }
     updateRequired = true;
   } else {
-    if (section->currentPage < section->pageCount - 1) {
+    // Pages past the ones laid out so far are shown once the build reaches them
+    if (section->currentPage < section->pageCount - 1 || section->buildInProgress) {
       section->currentPage++;
     } else {
       // We don't want to delete the section mid-render, so grab the semaphore
@@ -224,6 +249,79 @@ void EpubReaderActivity::displayTaskLoop() {
   }
 }
 
+void EpubReaderActivity::prelayoutTaskLoop() {
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    prelayoutBusy = true;
+    const int centerIndex = prelayoutCenterIndex;
+    // Readers mostly move forward, so the next chapter goes first
+    for (const int spineIndex : {centerIndex + 1, centerIndex - 1}) {
+      if (prelayoutStopped || prelayoutCenterIndex != centerIndex) {
+        break;
+      }
+      prelayoutSection(spineIndex, centerIndex);
+    }
+    prelayoutBusy = false;
+  }
+}
+
+void EpubReaderActivity::prelayoutSection(const int spineIndex, const int centerIndex) {
+  if (spineIndex < 0 || spineIndex >= epub->getSpineItemsCount()) {
+    return;
+  }
+
+  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  Section neighbour(epub, spineIndex, renderer);
+  if (!neighbour.loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                 SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, prelayoutViewportWidth,
+                                 prelayoutViewportHeight)) {
+    Serial.printf("[%lu] [ERS] Pre-laying out index %d\n", millis(), spineIndex);
+    const auto start = millis();
+    prelayoutBuildingIndex = spineIndex;
+    // Hand the mutex over between input chunks so page turns never wait on the whole build. The build is dropped
+    // once the reader has moved to another chapter or the activity is leaving
+    const bool built = neighbour.createSectionFile(
+        SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(), SETTINGS.extraParagraphSpacing,
+        SETTINGS.paragraphAlignment, prelayoutViewportWidth, prelayoutViewportHeight, nullptr, nullptr,
+        [this, centerIndex] {
+          xSemaphoreGive(renderingMutex);
+          xSemaphoreTake(renderingMutex, portMAX_DELAY);
+          return !prelayoutStopped && prelayoutCenterIndex == centerIndex;
+        });
+    prelayoutBuildingIndex = -1;
+    Serial.printf("[%lu] [ERS] Pre-layout of index %d %s in %lums\n", millis(), spineIndex,
+                  built ? "done" : "dropped", millis() - start);
+  }
+  xSemaphoreGive(renderingMutex);
+}
+
+void EpubReaderActivity::startPrelayout() {
+  prelayoutStopped = false;
+  prelayoutCenterIndex = currentSpineIndex;
+  if (prelayoutTaskHandle) {
+    xTaskNotifyGive(prelayoutTaskHandle);
+  }
+}
+
+// Must be called without holding renderingMutex, the background build needs it to notice the stop
+void EpubReaderActivity::stopPrelayout() {
+  prelayoutStopped = true;
+  while (prelayoutBusy) {
+    vTaskDelay(10 / portTICK_PERIOD_MS);
+  }
+}
+
+// Called with renderingMutex held. A background build parked between chunks keeps its inflater, parser and layout
+// state, so it is dropped before a foreground build allocates its own. startPrelayout picks the neighbours up again
+void EpubReaderActivity::cancelPrelayoutBuild() {
+  prelayoutStopped = true;
+  while (prelayoutBuildingIndex != -1) {
+    xSemaphoreGive(renderingMutex);
+    vTaskDelay(10 / portTICK_PERIOD_MS);
+    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  }
+}
+
 // TODO: Failure handling
 void EpubReaderActivity::renderScreen() {
   if (!epub) {
@@ -259,39 +357,57 @@ void EpubReaderActivity::renderScreen() {
   if (!section) {
     const auto filepath = epub->getSpineItem(currentSpineIndex).href;
     Serial.printf("[%lu] [ERS] Loading file: %s, index: %d\n", millis(), filepath.c_str(), currentSpineIndex);
-    section = std::unique_ptr<Section>(new Section(epub, currentSpineIndex, renderer));
 
     const uint16_t viewportWidth = renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
     const uint16_t viewportHeight = renderer.getScreenHeight() - orientedMarginTop - orientedMarginBottom;
+    prelayoutViewportWidth = viewportWidth;
+    prelayoutViewportHeight = viewportHeight;
+
+    // Progress bar dimensions
+    constexpr int barWidth = 200;
+    constexpr int barHeight = 10;
+    constexpr int boxMargin = 20;
+    const int textWidth = renderer.getTextWidth(UI_12_FONT_ID, "Indexing...");
+    const int boxWidthWithBar = (barWidth > textWidth ? barWidth : textWidth) + boxMargin * 2;
+    const int boxWidthNoBar = textWidth + boxMargin * 2;
+    const int boxHeightWithBar = renderer.getLineHeight(UI_12_FONT_ID) + barHeight + boxMargin * 3;
+    const int boxHeightNoBar = renderer.getLineHeight(UI_12_FONT_ID) + boxMargin * 2;
+    const int boxXWithBar = (renderer.getScreenWidth() - boxWidthWithBar) / 2;
+    const int boxXNoBar = (renderer.getScreenWidth() - boxWidthNoBar) / 2;
+    constexpr int boxY = 50;
+    const int barX = boxXWithBar + (boxWidthWithBar - barWidth) / 2;
+    const int barY = boxY + renderer.getLineHeight(UI_12_FONT_ID) + boxMargin * 2;
+
+    auto showIndexing = [this, boxXNoBar, boxWidthNoBar, boxHeightNoBar] {
+      renderer.fillRect(boxXNoBar, boxY, boxWidthNoBar, boxHeightNoBar, false);
+      renderer.drawText(UI_12_FONT_ID, boxXNoBar + boxMargin, boxY + boxMargin, "Indexing...");
+      renderer.drawRect(boxXNoBar + 5, boxY + 5, boxWidthNoBar - 10, boxHeightNoBar - 10);
+      renderer.flush();
+      pagesUntilFullRefresh = 0;
+    };
+
+    // The background pre-layout is part way through this chapter, let it finish rather than starting over. The
+    // mutex is released while waiting, so start from the top again in case the reader moved on meanwhile
+    if (prelayoutBuildingIndex == currentSpineIndex) {
+      Serial.printf("[%lu] [ERS] Waiting for background layout...\n", millis());
+      showIndexing();
+      while (prelayoutBuildingIndex == currentSpineIndex) {
+        xSemaphoreGive(renderingMutex);
+        vTaskDelay(10 / portTICK_PERIOD_MS);
+        xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      }
+      return renderScreen();
+    }
 
+    section = std::unique_ptr<Section>(new Section(epub, currentSpineIndex, renderer));
     if (!section->loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
                                   SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
                                   viewportHeight)) {
       Serial.printf("[%lu] [ERS] Cache not found, building...\n", millis());
-
-      // Progress bar dimensions
-      constexpr int barWidth = 200;
-      constexpr int barHeight = 10;
-      constexpr int boxMargin = 20;
-      const int textWidth = renderer.getTextWidth(UI_12_FONT_ID, "Indexing...");
-      const int boxWidthWithBar = (barWidth > textWidth ? barWidth : textWidth) + boxMargin * 2;
-      const int boxWidthNoBar = textWidth + boxMargin * 2;
-      const int boxHeightWithBar = renderer.getLineHeight(UI_12_FONT_ID) + barHeight + boxMargin * 3;
-      const int boxHeightNoBar = renderer.getLineHeight(UI_12_FONT_ID) + boxMargin * 2;
-      const int boxXWithBar = (renderer.getScreenWidth() - boxWidthWithBar) / 2;
-      const int boxXNoBar = (renderer.getScreenWidth() - boxWidthNoBar) / 2;
-      constexpr int boxY = 50;
-      const int barX = boxXWithBar + (boxWidthWithBar - barWidth) / 2;
-      const int barY = boxY + renderer.getLineHeight(UI_12_FONT_ID) + boxMargin * 2;
+      cancelPrelayoutBuild();
 
       // Always show "Indexing..." text first
-      {
-        renderer.fillRect(boxXNoBar, boxY, boxWidthNoBar, boxHeightNoBar, false);
-        renderer.drawText(UI_12_FONT_ID, boxXNoBar + boxMargin, boxY + boxMargin, "Indexing...");
-        renderer.drawRect(boxXNoBar + 5, boxY + 5, boxWidthNoBar - 10, boxHeightNoBar - 10);
-        renderer.displayBuffer();
-        pagesUntilFullRefresh = 0;
-      }
+      showIndexing();
 
       // Setup callback - only called for chapters >= 50KB, redraws with progress bar
       auto progressSetup = [this, boxXWithBar, boxWidthWithBar, boxHeightWithBar, barX, barY] {
@@ -299,32 +415,75 @@ void EpubReaderActivity::renderScreen() {
         renderer.drawText(UI_12_FONT_ID, boxXWithBar + boxMargin, boxY + boxMargin, "Indexing...");
         renderer.drawRect(boxXWithBar + 5, boxY + 5, boxWidthWithBar - 10, boxHeightWithBar - 10);
         renderer.drawRect(barX, barY, barWidth, barHeight);
-        renderer.displayBuffer();
+        renderer.flush();
       };
 
-      // Progress callback to update progress bar
-      auto progressCallback = [this, barX, barY, barWidth, barHeight](int progress) {
+      // Progress callback to update progress bar, stops once the reader is looking at a page
+      bool pageShown = false;
+      auto progressCallback = [this, &pageShown, barX, barY, barWidth, barHeight](int progress) {
+        if (pageShown) {
+          return;
+        }
         const int fillWidth = (barWidth - 2) * progress / 100;
         renderer.fillRect(barX + 1, barY + 1, fillWidth, barHeight - 2, true);
-        renderer.displayBuffer(EInkDisplay::FAST_REFRESH);
+        renderer.flush();
+      };
+
+      // Show the requested page as soon as it has been laid out and keep serving page turns while the rest of the
+      // chapter is built. Landing on the last page has to wait for the whole chapter
+      section->currentPage = nextPageNumber == UINT16_MAX ? 0 : nextPageNumber;
+      auto showBuiltPages = [&] {
+        if (nextPageNumber != UINT16_MAX && (!pageShown || updateRequired) &&
+            section->currentPage < section->pageCount) {
+          updateRequired = false;
+          pageShown = true;
+          renderer.clearScreen();
+          renderCurrentPage(orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
+        }
+        return true;
       };
 
       if (!section->createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
                                       SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
-                                      viewportHeight, progressSetup, progressCallback)) {
+                                      viewportHeight, progressSetup, progressCallback, showBuiltPages)) {
         Serial.printf("[%lu] [ERS] Failed to persist page data to SD\n", millis());
         section.reset();
         return;
       }
+
+      if (pageShown) {
+        if (section->currentPage >= section->pageCount) {
+          section->currentPage = section->pageCount - 1;
+          updateRequired = true;
+        }
+        // The page on screen is still current unless the reader turned it after the last chunk. Only its status bar
+        // is out of date, the page count was still provisional when it was drawn. The frame is redrawn as is so
+        // flush() only refreshes the status bar
+        if (!updateRequired) {
+          if (const auto page = section->loadPageFromSectionFile()) {
+            renderer.clearScreen();
+            page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+            renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
+            renderer.flush();
+          }
+          startPrelayout();
+          return;
+        }
+        updateRequired = false;
+      } else if (nextPageNumber == UINT16_MAX) {
+        section->currentPage = section->pageCount - 1;
+      }
     } else {
       Serial.printf("[%lu] [ERS] Cache found, skipping build...\n", millis());
+      if (nextPageNumber == UINT16_MAX) {
+        section->currentPage = section->pageCount - 1;
+      } else {
+        section->currentPage = nextPageNumber;
+      }
     }
 
-    if (nextPageNumber == UINT16_MAX) {
-      section->currentPage = section->pageCount - 1;
-    } else {
-      section->currentPage = nextPageNumber;
-    }
+    // Lay out the neighbouring chapters so the next chapter boundary is a cache hit
+    startPrelayout();
   }
 
   renderer.clearScreen();
@@ -345,15 +504,23 @@ void EpubReaderActivity::renderScreen() {
     return;
   }
 
+  if (!renderCurrentPage(orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft)) {
+    Serial.printf("[%lu] [ERS] Failed to load page from SD - clearing section cache\n", millis());
+    section->clearCache();
+    section.reset();
+    return renderScreen();
+  }
+}
+
+bool EpubReaderActivity::renderCurrentPage(const int orientedMarginTop, const int orientedMarginRight,
+                                           const int orientedMarginBottom, const int orientedMarginLeft) {
   {
     auto p = section->loadPageFromSectionFile();
     if (!p) {
-      Serial.printf("[%lu] [ERS] Failed to load page from SD - clearing section cache\n", millis());
-      section->clearCache();
-      section.reset();
-      return renderScreen();
+      return false;
     }
     const auto start = millis();
+    section->generatePageImages(*p);
     renderContents(std::move(p), orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
     Serial.printf("[%lu] [ERS] Rendered page in %dms\n", millis(), millis() - start);
   }
@@ -368,6 +535,7 @@ void EpubReaderActivity::renderScreen() {
     f.write(data, 4);
     f.close();
   }
+  return true;
 }
 
 void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int orientedMarginTop,
@@ -383,12 +551,18 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
     pagesUntilFullRefresh--;
   }
 
-  // Save bw buffer to reset buffer state after grayscale data sync
-  renderer.storeBwBuffer();
-
   // grayscale rendering
   // TODO: Only do this if font supports it
-  if (SETTINGS.textAntiAliasing) {
+  if (!SETTINGS.textAntiAliasing) {
+    return;
+  }
+
+  // Flow: BW display -> LSB and MSB planes -> grayscale display -> re-render BW for next frame
+  // Both planes come out of one page walk when there is room for the second plane, else one pass each
+  if (renderer.beginGrayscale()) {
+    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+    renderer.copyGrayscaleBuffers();
+  } else {
     renderer.clearScreen(0x00);
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
     page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
@@ -399,14 +573,17 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
     page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
     renderer.copyGrayscaleMsbBuffers();
-
-    // display grayscale part
-    renderer.displayGrayBuffer();
-    renderer.setRenderMode(GfxRenderer::BW);
   }
 
-  // restore the bw data
-  renderer.restoreBwBuffer();
+  // display grayscale part
+  renderer.displayGrayBuffer();
+  renderer.setRenderMode(GfxRenderer::BW);
+
+  // Re-render BW to the framebuffer, the controller needs it to diff the next frame against
+  renderer.clearScreen();
+  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
+  renderer.cleanupGrayscaleWithFrameBuffer();
 }
 
 void EpubReaderActivity::renderStatusBar(const int orientedMarginRight, const int orientedMarginBottom,
@@ -429,8 +606,9 @@ void EpubReaderActivity::renderStatusBar(const int orientedMarginRight, const in
     const uint8_t bookProgress = epub->calculateProgress(currentSpineIndex, sectionChapterProg);
 
     // Right aligned text for progress counter
+    // The page count is still growing while the chapter is being laid out
     const std::string progress = std::to_string(section->currentPage + 1) + "/" + std::to_string(section->pageCount) +
-                                 "  " + std::to_string(bookProgress) + "%";
+                                 (section->buildInProgress ? "+" : "") + "  " + std::to_string(bookProgress) + "%";
     progressTextWidth = renderer.getTextWidth(SMALL_FONT_ID, progress.c_str());
     renderer.drawText(SMALL_FONT_ID, renderer.getScreenWidth() - orientedMarginRight - progressTextWidth, textY,
                       progress.c_str());
@@ -455,12 +633,8 @@ void EpubReaderActivity::renderStatusBar(const int orientedMarginRight, const in
       titleWidth = renderer.getTextWidth(SMALL_FONT_ID, "Unnamed");
     } else {
       const auto tocItem = epub->getTocItem(tocIndex);
-      title = tocItem.title;
-      titleWidth = renderer.getTextWidth(SMALL_FONT_ID, title.c_str());
-      while (titleWidth > availableTextWidth && title.length() > 11) {
-        title.replace(title.length() - 8, 8, "...");
-        titleWidth = renderer.getTextWidth(SMALL_FONT_ID, title.c_str());
-      }
+      title = renderer.truncatedText(SMALL_FONT_ID, tocItem.title.c_str(), availableTextWidth, EpdFontFamily::REGULAR,
+                                     &titleWidth);
     }
 
     renderer.drawText(SMALL_FONT_ID, titleMarginLeft + (availableTextWidth - titleWidth) / 2, textY, title.c_str());
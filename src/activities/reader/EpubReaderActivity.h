@@ -11,8 +11,16 @@ class EpubReaderActivity final : public ActivityWithSubactivity {
   std::shared_ptr<Epub> epub;
   std::unique_ptr<Section> section = nullptr;
   TaskHandle_t displayTaskHandle = nullptr;
+  TaskHandle_t prelayoutTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
   int currentSpineIndex = 0;
+  // Background pre-layout of the chapters around prelayoutCenterIndex, prelayoutBuildingIndex is -1 when idle
+  volatile int prelayoutCenterIndex = -1;
+  volatile int prelayoutBuildingIndex = -1;
+  volatile bool prelayoutBusy = false;
+  volatile bool prelayoutStopped = false;
+  uint16_t prelayoutViewportWidth = 0;
+  uint16_t prelayoutViewportHeight = 0;
   int nextPageNumber = 0;
   int pagesUntilFullRefresh = 0;
   bool updateRequired = false;
@@ -21,7 +29,15 @@ class EpubReaderActivity final : public ActivityWithSubactivity {
 
   static void taskTrampoline(void* param);
   [[noreturn]] void displayTaskLoop();
+  static void prelayoutTaskTrampoline(void* param);
+  [[noreturn]] void prelayoutTaskLoop();
+  void prelayoutSection(int spineIndex, int centerIndex);
+  void cancelPrelayoutBuild();
+  void startPrelayout();
+  void stopPrelayout();
   void renderScreen();
+  bool renderCurrentPage(int orientedMarginTop, int orientedMarginRight, int orientedMarginBottom,
+                         int orientedMarginLeft);
   void renderContents(std::unique_ptr<Page> page, int orientedMarginTop, int orientedMarginRight,
                       int orientedMarginBottom, int orientedMarginLeft);
   void renderStatusBar(int orientedMarginRight, int orientedMarginBottom, int orientedMarginLeft) const;
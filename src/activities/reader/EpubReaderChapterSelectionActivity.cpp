@@ -127,12 +127,12 @@ void EpubReaderChapterSelectionActivity::renderScreen() {
 
   const auto pageStartIndex = selectorIndex / pageItems * pageItems;
   renderer.fillRect(0, 60 + (selectorIndex % pageItems) * 30 - 2, pageWidth - 1, 30);
-  for (int tocIndex = pageStartIndex; tocIndex < epub->getTocItemsCount() && tocIndex < pageStartIndex + pageItems;
-       tocIndex++) {
-    auto item = epub->getTocItem(tocIndex);
-    renderer.drawText(UI_10_FONT_ID, 20 + (item.level - 1) * 15, 60 + (tocIndex % pageItems) * 30, item.title.c_str(),
-                      tocIndex != selectorIndex);
+  const auto items = epub->getTocTitles(pageStartIndex, pageItems);
+  for (int i = 0; i < static_cast<int>(items.size()); i++) {
+    const int tocIndex = pageStartIndex + i;
+    renderer.drawText(UI_10_FONT_ID, 20 + (items[i].level - 1) * 15, 60 + (tocIndex % pageItems) * 30,
+                      items[i].title.c_str(), tocIndex != selectorIndex);
   }
 
-  renderer.displayBuffer();
+  renderer.flush();
 }
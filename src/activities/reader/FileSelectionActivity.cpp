@@ -188,7 +188,7 @@ void FileSelectionActivity::render() const {
 
   if (files.empty()) {
     renderer.drawText(UI_10_FONT_ID, 20, 60, "No books found");
-    renderer.displayBuffer();
+    renderer.flush();
     return;
   }
 
@@ -199,7 +199,7 @@ void FileSelectionActivity::render() const {
     renderer.drawText(UI_10_FONT_ID, 20, 60 + (i % PAGE_ITEMS) * 30, item.c_str(), i != selectorIndex);
   }
 
-  renderer.displayBuffer();
+  renderer.flush();
 }
 
 size_t FileSelectionActivity::findEntry(const std::string& name) const {
@@ -20,6 +20,8 @@
 namespace {
 constexpr unsigned long skipPageMs = 700;
 constexpr unsigned long goHomeMs = 1000;
+// Heap that has to stay free after the read-ahead buffer is taken, for the gray plane, SD and the rest of the reader
+constexpr size_t prefetchHeapMargin = 64 * 1024;
 }  // namespace
 
 void XtcReaderActivity::taskTrampoline(void* param) {
@@ -27,6 +29,11 @@ void XtcReaderActivity::taskTrampoline(void* param) {
   self->displayTaskLoop();
 }
 
+void XtcReaderActivity::prefetchTaskTrampoline(void* param) {
+  auto* self = static_cast<XtcReaderActivity*>(param);
+  self->prefetchTaskLoop();
+}
+
 void XtcReaderActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
@@ -38,6 +45,25 @@ void XtcReaderActivity::onEnter() {
 
   xtc->setupCacheDir();
 
+  // XTG (1-bit): Row-major, ((width+7)/8) * height bytes
+  // XTH (2-bit): Two bit planes, column-major, ((width * height + 7) / 8) * 2 bytes
+  const uint16_t pageWidth = xtc->getPageWidth();
+  const uint16_t pageHeight = xtc->getPageHeight();
+  if (xtc->getBitDepth() == 2) {
+    pageBufferSize = ((static_cast<size_t>(pageWidth) * pageHeight + 7) / 8) * 2;
+  } else {
+    pageBufferSize = ((pageWidth + 7) / 8) * pageHeight;
+  }
+  pageBuffers[0] = static_cast<uint8_t*>(malloc(pageBufferSize));
+  // A 2-bit page is about 96KB, so the read-ahead buffer is only taken when the heap can spare it. Without it pages
+  // are still shown, just without read-ahead
+  if (pageBuffers[0] && ESP.getFreeHeap() >= pageBufferSize + prefetchHeapMargin) {
+    pageBuffers[1] = static_cast<uint8_t*>(malloc(pageBufferSize));
+  }
+  if (!pageBuffers[1]) {
+    Serial.printf("[%lu] [XTR] No memory for page prefetch (%lu bytes per page)\n", millis(), pageBufferSize);
+  }
+
   // Load saved progress
   loadProgress();
 
@@ -54,6 +80,15 @@ void XtcReaderActivity::onEnter() {
               1,                  // Priority
               &displayTaskHandle  // Task handle
   );
+
+  if (pageBuffers[1]) {
+    xTaskCreate(&XtcReaderActivity::prefetchTaskTrampoline, "XtcReaderPrefetchTask",
+                3072,                // Stack size
+                this,                // Parameters
+                0,                   // Priority
+                &prefetchTaskHandle  // Task handle
+    );
+  }
 }
 
 void XtcReaderActivity::onExit() {
@@ -65,8 +100,17 @@ void XtcReaderActivity::onExit() {
     vTaskDelete(displayTaskHandle);
     displayTaskHandle = nullptr;
   }
+  if (prefetchTaskHandle) {
+    vTaskDelete(prefetchTaskHandle);
+    prefetchTaskHandle = nullptr;
+  }
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
+  for (int i = 0; i < 2; i++) {
+    free(pageBuffers[i]);
+    pageBuffers[i] = nullptr;
+    bufferedPages[i] = NO_PAGE;
+  }
   xtc.reset();
 }
 
@@ -128,6 +172,7 @@ void XtcReaderActivity::loop() {
   const bool skipPages = mappedInput.getHeldTime() > skipPageMs;
   const int skipAmount = skipPages ? 10 : 1;
 
+  lastTurnBackward = prevReleased;
   if (prevReleased) {
     if (currentPage >= static_cast<uint32_t>(skipAmount)) {
       currentPage -= skipAmount;
@@ -156,6 +201,60 @@ void XtcReaderActivity::displayTaskLoop() {
   }
 }
 
+void XtcReaderActivity::prefetchTaskLoop() {
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    const uint32_t page = prefetchPage;
+    if (page < xtc->getPageCount() && bufferedPages[0] != page && bufferedPages[1] != page) {
+      const auto start = millis();
+      const int spare = shownBuffer ^ 1;
+      bufferedPages[spare] = NO_PAGE;
+      if (xtc->loadPage(page, pageBuffers[spare], pageBufferSize) > 0) {
+        bufferedPages[spare] = page;
+        Serial.printf("[%lu] [XTR] Prefetched page %lu in %lums\n", millis(), page, millis() - start);
+      }
+    }
+    xSemaphoreGive(renderingMutex);
+  }
+}
+
+// Reads the page the reader is most likely to turn to next, in the direction of the last turn
+void XtcReaderActivity::startPrefetch() {
+  if (!prefetchTaskHandle) {
+    return;
+  }
+  if (lastTurnBackward) {
+    prefetchPage = currentPage > 0 ? currentPage - 1 : NO_PAGE;
+  } else {
+    prefetchPage = currentPage + 1;
+  }
+  xTaskNotifyGive(prefetchTaskHandle);
+}
+
+uint8_t* XtcReaderActivity::pageBufferFor(const uint32_t page) {
+  for (int i = 0; i < 2; i++) {
+    if (bufferedPages[i] == page) {
+      shownBuffer = i;
+      return pageBuffers[i];
+    }
+  }
+
+  if (!pageBuffers[0]) {
+    return nullptr;
+  }
+
+  // A miss replaces the page read ahead, the page on screen stays around for a turn back
+  const int target = pageBuffers[1] ? shownBuffer ^ 1 : 0;
+  bufferedPages[target] = NO_PAGE;
+  if (xtc->loadPage(page, pageBuffers[target], pageBufferSize) == 0) {
+    return nullptr;
+  }
+  bufferedPages[target] = page;
+  shownBuffer = target;
+  return pageBuffers[target];
+}
+
 void XtcReaderActivity::renderScreen() {
   if (!xtc) {
     return;
@@ -179,20 +278,8 @@ void XtcReaderActivity::renderPage() {
   const uint16_t pageHeight = xtc->getPageHeight();
   const uint8_t bitDepth = xtc->getBitDepth();
 
-  // Calculate buffer size for one page
-  // XTG (1-bit): Row-major, ((width+7)/8) * height bytes
-  // XTH (2-bit): Two bit planes, column-major, ((width * height + 7) / 8) * 2 bytes
-  size_t pageBufferSize;
-  if (bitDepth == 2) {
-    pageBufferSize = ((static_cast<size_t>(pageWidth) * pageHeight + 7) / 8) * 2;
-  } else {
-    pageBufferSize = ((pageWidth + 7) / 8) * pageHeight;
-  }
-
-  // Allocate page buffer
-  uint8_t* pageBuffer = static_cast<uint8_t*>(malloc(pageBufferSize));
-  if (!pageBuffer) {
-    Serial.printf("[%lu] [XTR] Failed to allocate page buffer (%lu bytes)\n", millis(), pageBufferSize);
+  if (!pageBuffers[0]) {
+    Serial.printf("[%lu] [XTR] No page buffer (%lu bytes)\n", millis(), pageBufferSize);
     renderer.clearScreen();
     renderer.drawCenteredText(UI_12_FONT_ID, 300, "Memory error", true, EpdFontFamily::BOLD);
     renderer.displayBuffer();
@@ -200,10 +287,9 @@ void XtcReaderActivity::renderPage() {
   }
 
   // Load page data
-  size_t bytesRead = xtc->loadPage(currentPage, pageBuffer, pageBufferSize);
-  if (bytesRead == 0) {
+  const uint8_t* pageBuffer = pageBufferFor(currentPage);
+  if (!pageBuffer) {
     Serial.printf("[%lu] [XTR] Failed to load page %lu\n", millis(), currentPage);
-    free(pageBuffer);
     renderer.clearScreen();
     renderer.drawCenteredText(UI_12_FONT_ID, 300, "Page load error", true, EpdFontFamily::BOLD);
     renderer.displayBuffer();
@@ -213,10 +299,7 @@ void XtcReaderActivity::renderPage() {
   // Clear screen first
   renderer.clearScreen();
 
-  // Copy page bitmap using GfxRenderer's drawPixel
   // XTC/XTCH pages are pre-rendered with status bar included, so render full page
-  const uint16_t maxSrcY = pageHeight;
-
   if (bitDepth == 2) {
     // XTH 2-bit mode: Two bit planes, column-major order
     // - Columns scanned right to left (x = width-1 down to 0)
@@ -228,40 +311,12 @@ void XtcReaderActivity::renderPage() {
     const size_t planeSize = (static_cast<size_t>(pageWidth) * pageHeight + 7) / 8;
     const uint8_t* plane1 = pageBuffer;              // Bit1 plane
     const uint8_t* plane2 = pageBuffer + planeSize;  // Bit2 plane
-    const size_t colBytes = (pageHeight + 7) / 8;    // Bytes per column (100 for 800 height)
-
-    // Lambda to get pixel value at (x, y)
-    auto getPixelValue = [&](uint16_t x, uint16_t y) -> uint8_t {
-      const size_t colIndex = pageWidth - 1 - x;
-      const size_t byteInCol = y / 8;
-      const size_t bitInByte = 7 - (y % 8);
-      const size_t byteOffset = colIndex * colBytes + byteInCol;
-      const uint8_t bit1 = (plane1[byteOffset] >> bitInByte) & 1;
-      const uint8_t bit2 = (plane2[byteOffset] >> bitInByte) & 1;
-      return (bit1 << 1) | bit2;
-    };
 
     // Optimized grayscale rendering without storeBwBuffer (saves 48KB peak memory)
     // Flow: BW display → LSB/MSB passes → grayscale display → re-render BW for next frame
 
-    // Count pixel distribution for debugging
-    uint32_t pixelCounts[4] = {0, 0, 0, 0};
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        pixelCounts[getPixelValue(x, y)]++;
-      }
-    }
-    Serial.printf("[%lu] [XTR] Pixel distribution: White=%lu, DarkGrey=%lu, LightGrey=%lu, Black=%lu\n", millis(),
-                  pixelCounts[0], pixelCounts[1], pixelCounts[2], pixelCounts[3]);
-
     // Pass 1: BW buffer - draw all non-white pixels as black
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        if (getPixelValue(x, y) >= 1) {
-          renderer.drawPixel(x, y, true);
-        }
-      }
-    }
+    renderer.drawColumnPlanes(plane1, plane2, pageWidth, pageHeight);
 
     // Display BW with conditional refresh based on pagesUntilFullRefresh
     if (pagesUntilFullRefresh <= 1) {
@@ -275,71 +330,37 @@ void XtcReaderActivity::renderPage() {
     // Pass 2: LSB buffer - mark DARK gray only (XTH value 1)
     // In LUT: 0 bit = apply gray effect, 1 bit = untouched
     renderer.clearScreen(0x00);
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        if (getPixelValue(x, y) == 1) {  // Dark grey only
-          renderer.drawPixel(x, y, false);
-        }
-      }
-    }
+    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+    renderer.drawColumnPlanes(plane1, plane2, pageWidth, pageHeight);
     renderer.copyGrayscaleLsbBuffers();
 
     // Pass 3: MSB buffer - mark LIGHT AND DARK gray (XTH value 1 or 2)
     // In LUT: 0 bit = apply gray effect, 1 bit = untouched
     renderer.clearScreen(0x00);
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        const uint8_t pv = getPixelValue(x, y);
-        if (pv == 1 || pv == 2) {  // Dark grey or Light grey
-          renderer.drawPixel(x, y, false);
-        }
-      }
-    }
+    renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+    renderer.drawColumnPlanes(plane1, plane2, pageWidth, pageHeight);
     renderer.copyGrayscaleMsbBuffers();
 
     // Display grayscale overlay
     renderer.displayGrayBuffer();
 
     // Pass 4: Re-render BW to framebuffer (restore for next frame, instead of restoreBwBuffer)
+    renderer.setRenderMode(GfxRenderer::BW);
     renderer.clearScreen();
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        if (getPixelValue(x, y) >= 1) {
-          renderer.drawPixel(x, y, true);
-        }
-      }
-    }
+    renderer.drawColumnPlanes(plane1, plane2, pageWidth, pageHeight);
 
     // Cleanup grayscale buffers with current frame buffer
     renderer.cleanupGrayscaleWithFrameBuffer();
 
-    free(pageBuffer);
+    startPrefetch();
 
     Serial.printf("[%lu] [XTR] Rendered page %lu/%lu (2-bit grayscale)\n", millis(), currentPage + 1,
                   xtc->getPageCount());
     return;
-  } else {
-    // 1-bit mode: 8 pixels per byte, MSB first
-    const size_t srcRowBytes = (pageWidth + 7) / 8;  // 60 bytes for 480 width
-
-    for (uint16_t srcY = 0; srcY < maxSrcY; srcY++) {
-      const size_t srcRowStart = srcY * srcRowBytes;
-
-      for (uint16_t srcX = 0; srcX < pageWidth; srcX++) {
-        // Read source pixel (MSB first, bit 7 = leftmost pixel)
-        const size_t srcByte = srcRowStart + srcX / 8;
-        const size_t srcBit = 7 - (srcX % 8);
-        const bool isBlack = !((pageBuffer[srcByte] >> srcBit) & 1);  // XTC: 0 = black, 1 = white
-
-        if (isBlack) {
-          renderer.drawPixel(srcX, srcY, true);
-        }
-      }
-    }
   }
-  // White pixels are already cleared by clearScreen()
 
-  free(pageBuffer);
+  // 1-bit mode: 8 pixels per byte, MSB first, 0 = black
+  renderer.drawPackedRows(pageBuffer, pageWidth, pageHeight);
 
   // XTC pages already have status bar pre-rendered, no need to add our own
 
@@ -352,6 +373,8 @@ void XtcReaderActivity::renderPage() {
     pagesUntilFullRefresh--;
   }
 
+  startPrefetch();
+
   Serial.printf("[%lu] [XTR] Rendered page %lu/%lu (%u-bit)\n", millis(), currentPage + 1, xtc->getPageCount(),
                 bitDepth);
 }
@@ -15,9 +15,20 @@
 #include "activities/ActivityWithSubactivity.h"
 
 class XtcReaderActivity final : public ActivityWithSubactivity {
+  static constexpr uint32_t NO_PAGE = UINT32_MAX;
+
   std::shared_ptr<Xtc> xtc;
   TaskHandle_t displayTaskHandle = nullptr;
+  TaskHandle_t prefetchTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
+  // Page buffers allocated once on entry, one holds the page on screen and the other the page read ahead in the
+  // background. Both are only touched with renderingMutex held
+  uint8_t* pageBuffers[2] = {nullptr, nullptr};
+  uint32_t bufferedPages[2] = {NO_PAGE, NO_PAGE};
+  size_t pageBufferSize = 0;
+  int shownBuffer = 0;
+  volatile uint32_t prefetchPage = NO_PAGE;
+  bool lastTurnBackward = false;
   uint32_t currentPage = 0;
   int pagesUntilFullRefresh = 0;
   bool updateRequired = false;
@@ -26,6 +37,11 @@ class XtcReaderActivity final : public ActivityWithSubactivity {
 
   static void taskTrampoline(void* param);
   [[noreturn]] void displayTaskLoop();
+  static void prefetchTaskTrampoline(void* param);
+  [[noreturn]] void prefetchTaskLoop();
+  void startPrefetch();
+  // Buffer holding the given page, read from the card unless it was prefetched. nullptr if it could not be loaded
+  uint8_t* pageBufferFor(uint32_t page);
   void renderScreen();
   void renderPage();
   void saveProgress() const;
@@ -135,7 +135,7 @@ void XtcReaderChapterSelectionActivity::renderScreen() {
   const auto& chapters = xtc->getChapters();
   if (chapters.empty()) {
     renderer.drawCenteredText(UI_10_FONT_ID, 120, "No chapters");
-    renderer.displayBuffer();
+    renderer.flush();
     return;
   }
 
@@ -147,5 +147,5 @@ void XtcReaderChapterSelectionActivity::renderScreen() {
     renderer.drawText(UI_10_FONT_ID, 20, 60 + (i % pageItems) * 30, title, i != selectorIndex);
   }
 
-  renderer.displayBuffer();
+  renderer.flush();
 }
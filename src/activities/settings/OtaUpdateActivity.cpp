@@ -131,7 +131,7 @@ void OtaUpdateActivity::render() {
 
   if (state == CHECKING_FOR_UPDATE) {
     renderer.drawCenteredText(UI_10_FONT_ID, 300, "Checking for update...", true, EpdFontFamily::BOLD);
-    renderer.displayBuffer();
+    renderer.flush();
     return;
   }
 
@@ -142,7 +142,7 @@ void OtaUpdateActivity::render() {
 
     const auto labels = mappedInput.mapLabels("Cancel", "Update", "", "");
     renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
-    renderer.displayBuffer();
+    renderer.flush();
     return;
   }
 
@@ -155,26 +155,26 @@ void OtaUpdateActivity::render() {
     renderer.drawCenteredText(
         UI_10_FONT_ID, 440,
         (std::to_string(updater.processedSize) + " / " + std::to_string(updater.totalSize)).c_str());
-    renderer.displayBuffer();
+    renderer.flush();
     return;
   }
 
   if (state == NO_UPDATE) {
     renderer.drawCenteredText(UI_10_FONT_ID, 300, "No update available", true, EpdFontFamily::BOLD);
-    renderer.displayBuffer();
+    renderer.flush();
     return;
   }
 
   if (state == FAILED) {
     renderer.drawCenteredText(UI_10_FONT_ID, 300, "Update failed", true, EpdFontFamily::BOLD);
-    renderer.displayBuffer();
+    renderer.flush();
     return;
   }
 
   if (state == FINISHED) {
     renderer.drawCenteredText(UI_10_FONT_ID, 300, "Update complete", true, EpdFontFamily::BOLD);
     renderer.drawCenteredText(UI_10_FONT_ID, 350, "Press and hold power button to turn back on");
-    renderer.displayBuffer();
+    renderer.flush();
     state = SHUTTING_DOWN;
     return;
   }
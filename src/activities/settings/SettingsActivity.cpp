@@ -218,5 +218,5 @@ void SettingsActivity::render() const {
   renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
   // Always use standard refresh for settings screen
-  renderer.displayBuffer();
+  renderer.flush();
 }
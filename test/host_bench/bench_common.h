@@ -0,0 +1,87 @@
+#pragma once
+#include <GfxRenderer.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace bench {
+
+inline double nowMs() {
+  using namespace std::chrono;
+  return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Best wall clock time of a few runs, the host is noisy enough that averages hide the actual cost
+template <typename Fn>
+double bestOfMs(const int runs, Fn&& fn) {
+  double best = 1e30;
+  for (int run = 0; run < runs; run++) {
+    const double start = nowMs();
+    fn();
+    const double elapsed = nowMs() - start;
+    if (elapsed < best) {
+      best = elapsed;
+    }
+  }
+  return best;
+}
+
+// FNV-1a over a buffer, printed next to timings so a faster path can be checked for identical output
+inline uint64_t hash(const uint8_t* data, const size_t size, uint64_t h = 14695981039346656037ull) {
+  for (size_t i = 0; i < size; i++) {
+    h = (h ^ data[i]) * 1099511628211ull;
+  }
+  return h;
+}
+
+// Deterministic book-like text: words of 1-12 letters with the odd bold or italic run
+class TextSource {
+  uint32_t state;
+
+ public:
+  explicit TextSource(const uint32_t seed) : state(seed) {}
+
+  uint32_t next() {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+  }
+
+  std::string word() {
+    static const char letters[] = "etaoinshrdlucmfwypvbgkqjxz";
+    std::string word;
+    const int length = 1 + next() % 12;
+    for (int i = 0; i < length; i++) {
+      // Skew towards the common letters like real text does
+      word += letters[(next() % 26) * (next() % 26) / 26];
+    }
+    return word;
+  }
+
+  EpdFontFamily::Style style() {
+    const uint32_t roll = next() % 20;
+    return roll == 0 ? EpdFontFamily::BOLD : roll == 1 ? EpdFontFamily::ITALIC : EpdFontFamily::REGULAR;
+  }
+};
+
+// Fills the screen with left aligned lines of words, the way a reader page is drawn
+inline void drawTextPage(const GfxRenderer& renderer, const int fontId, TextSource& text, const int margin) {
+  const int lineHeight = renderer.getLineHeight(fontId);
+  const int spaceWidth = renderer.getSpaceWidth(fontId);
+  for (int y = margin; y + lineHeight <= renderer.getScreenHeight() - margin; y += lineHeight) {
+    int x = margin;
+    while (true) {
+      const std::string word = text.word();
+      const auto style = text.style();
+      const int width = renderer.getTextWidth(fontId, word.c_str(), style);
+      if (x + width > renderer.getScreenWidth() - margin) {
+        break;
+      }
+      renderer.drawText(fontId, x, y, word.c_str(), true, style);
+      x += width + spaceWidth;
+    }
+  }
+}
+
+}  // namespace bench
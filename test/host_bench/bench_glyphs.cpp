@@ -0,0 +1,68 @@
+// Text rasterization: 20 pages of text drawn in every orientation and render mode, plus the clipped and quarter
+// turned text used by the button hints. Reports the best of 5 runs per combination and a hash of the frame buffers
+#include <GfxRenderer.h>
+#include <builtinFonts/all.h>
+
+#include "bench_common.h"
+
+namespace {
+constexpr int BOOK_FONT_ID = 1;
+constexpr int UI_FONT_ID = 2;
+constexpr int PAGE_COUNT = 20;
+constexpr int RUNS = 5;
+
+EInkDisplay display;
+GfxRenderer renderer(display);
+EpdFont bookRegular(&bookerly_14_regular);
+EpdFont bookBold(&bookerly_14_bold);
+EpdFont bookItalic(&bookerly_14_italic);
+EpdFont bookBoldItalic(&bookerly_14_bolditalic);
+EpdFontFamily bookFamily(&bookRegular, &bookBold, &bookItalic, &bookBoldItalic);
+EpdFont uiRegular(&ubuntu_10_regular);
+EpdFontFamily uiFamily(&uiRegular);
+
+const char* const MODE_NAMES[] = {"BW", "LSB", "MSB"};
+const char* const ORIENTATION_NAMES[] = {"portrait", "landscape cw", "portrait inverted", "landscape ccw"};
+}  // namespace
+
+int main() {
+  renderer.insertFont(BOOK_FONT_ID, bookFamily);
+  renderer.insertFont(UI_FONT_ID, uiFamily);
+
+  const GfxRenderer::RenderMode modes[] = {GfxRenderer::BW, GfxRenderer::GRAYSCALE_LSB, GfxRenderer::GRAYSCALE_MSB};
+  double totalMs = 0;
+  uint64_t totalHash = bench::hash(nullptr, 0);
+  for (int orientation = 0; orientation < 4; orientation++) {
+    renderer.setOrientation(static_cast<GfxRenderer::Orientation>(orientation));
+    for (int mode = 0; mode < 3; mode++) {
+      renderer.setRenderMode(modes[mode]);
+      // The gray passes mark their pixels on a cleared plane, the same way the readers draw them
+      const uint8_t clearColor = modes[mode] == GfxRenderer::BW ? 0xFF : 0x00;
+      uint64_t hash = bench::hash(nullptr, 0);
+      const double pagesMs = bench::bestOfMs(RUNS, [&] {
+        bench::TextSource text(42);
+        hash = bench::hash(nullptr, 0);
+        for (int page = 0; page < PAGE_COUNT; page++) {
+          renderer.clearScreen(clearColor);
+          bench::drawTextPage(renderer, BOOK_FONT_ID, text, 10);
+          hash = bench::hash(display.getFrameBuffer(), EInkDisplay::BUFFER_SIZE, hash);
+        }
+      });
+      const double hintsMs = bench::bestOfMs(RUNS, [&] {
+        for (int page = 0; page < PAGE_COUNT; page++) {
+          renderer.clearScreen(clearColor);
+          renderer.drawText(UI_FONT_ID, -5, 3, "Clipped at the edges of the screen gyq");
+          renderer.drawButtonHints(UI_FONT_ID, "Back", "Open", "Up", "Down");
+          renderer.drawSideButtonHints(UI_FONT_ID, "Prev", "Next");
+        }
+      });
+      hash = bench::hash(display.getFrameBuffer(), EInkDisplay::BUFFER_SIZE, hash);
+      totalMs += pagesMs + hintsMs;
+      totalHash = bench::hash(reinterpret_cast<const uint8_t*>(&hash), sizeof(hash), totalHash);
+      printf("%-17s %-3s  %d pages %7.2f ms  hints %6.2f ms  hash %016llx\n", ORIENTATION_NAMES[orientation],
+             MODE_NAMES[mode], PAGE_COUNT, pagesMs, hintsMs, static_cast<unsigned long long>(hash));
+    }
+  }
+  printf("total %.2f ms, hash %016llx\n", totalMs, static_cast<unsigned long long>(totalHash));
+  return 0;
+}
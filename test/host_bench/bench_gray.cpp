@@ -0,0 +1,104 @@
+// Anti-aliased page render: the gray planes drawn one pass each (GRAYSCALE_LSB then GRAYSCALE_MSB) against both planes
+// from a single walk (GRAYSCALE). Reports the best of 5 runs over 20 pages and checks that both produce the same
+// planes, for text and for XTC style column planes
+#include <GfxRenderer.h>
+#include <builtinFonts/all.h>
+
+#include <vector>
+
+#include "bench_common.h"
+
+namespace {
+constexpr int BOOK_FONT_ID = 1;
+constexpr int PAGE_COUNT = 20;
+constexpr int RUNS = 5;
+
+EInkDisplay display;
+GfxRenderer renderer(display);
+EpdFont bookRegular(&bookerly_14_regular);
+EpdFont bookBold(&bookerly_14_bold);
+EpdFont bookItalic(&bookerly_14_italic);
+EpdFont bookBoldItalic(&bookerly_14_bolditalic);
+EpdFontFamily bookFamily(&bookRegular, &bookBold, &bookItalic, &bookBoldItalic);
+
+uint64_t planesHash(uint64_t h) {
+  h = bench::hash(display.grayLsb, EInkDisplay::BUFFER_SIZE, h);
+  return bench::hash(display.grayMsb, EInkDisplay::BUFFER_SIZE, h);
+}
+
+template <typename Draw>
+uint64_t twoPasses(Draw&& draw) {
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+  draw();
+  renderer.copyGrayscaleLsbBuffers();
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+  draw();
+  renderer.copyGrayscaleMsbBuffers();
+  renderer.setRenderMode(GfxRenderer::BW);
+  return planesHash(bench::hash(nullptr, 0));
+}
+
+template <typename Draw>
+uint64_t oneWalk(Draw&& draw) {
+  if (!renderer.beginGrayscale()) {
+    printf("!! beginGrayscale failed\n");
+    exit(1);
+  }
+  draw();
+  renderer.copyGrayscaleBuffers();
+  return planesHash(bench::hash(nullptr, 0));
+}
+}  // namespace
+
+int main() {
+  renderer.insertFont(BOOK_FONT_ID, bookFamily);
+
+  for (const bool single : {false, true}) {
+    uint64_t hash = 0;
+    const double pagesMs = bench::bestOfMs(RUNS, [&] {
+      bench::TextSource text(42);
+      hash = bench::hash(nullptr, 0);
+      for (int page = 0; page < PAGE_COUNT; page++) {
+        // Both variants have to draw the same page, so the words are picked once per page
+        bench::TextSource pageText = text;
+        const auto draw = [&] {
+          bench::TextSource words = pageText;
+          bench::drawTextPage(renderer, BOOK_FONT_ID, words, 10);
+          text = words;
+        };
+        const uint64_t pageHash = single ? oneWalk(draw) : twoPasses(draw);
+        hash = bench::hash(reinterpret_cast<const uint8_t*>(&pageHash), sizeof(pageHash), hash);
+      }
+    });
+    printf("text    %-11s %d pages %7.2f ms  hash %016llx\n", single ? "one walk" : "two passes", PAGE_COUNT, pagesMs,
+           static_cast<unsigned long long>(hash));
+  }
+
+  // 2-bit XTC page planes of noise, every value shows up in every byte
+  constexpr int width = 480;
+  constexpr int height = 800;
+  std::vector<uint8_t> plane1(width * height / 8);
+  std::vector<uint8_t> plane2(width * height / 8);
+  bench::TextSource noise(7);
+  for (size_t i = 0; i < plane1.size(); i++) {
+    plane1[i] = noise.next();
+    plane2[i] = noise.next();
+  }
+  for (const auto orientation : {GfxRenderer::Portrait, GfxRenderer::LandscapeCounterClockwise}) {
+    renderer.setOrientation(orientation);
+    for (const bool single : {false, true}) {
+      uint64_t hash = 0;
+      const auto draw = [&] {
+        renderer.drawColumnPlanes(plane1.data(), plane2.data(), orientation == GfxRenderer::Portrait ? width : 200,
+                                  orientation == GfxRenderer::Portrait ? height : 200);
+      };
+      const double pageMs = bench::bestOfMs(RUNS, [&] { hash = single ? oneWalk(draw) : twoPasses(draw); });
+      printf("xtc %-4s %-11s        %7.2f ms  hash %016llx\n",
+             orientation == GfxRenderer::Portrait ? "fast" : "slow", single ? "one walk" : "two passes", pageMs,
+             static_cast<unsigned long long>(hash));
+    }
+  }
+  return 0;
+}
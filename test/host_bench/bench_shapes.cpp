@@ -0,0 +1,160 @@
+// Rectangles and boxes: fillRect, drawRect, clearRect, invertRect and the rounded boxes in every orientation, timed
+// against drawing the same shape a drawPixel at a time. Random rectangles (some hanging off the screen) are first
+// checked against that per pixel reference on a noisy frame buffer
+#include <GfxRenderer.h>
+
+#include <cstring>
+#include <vector>
+
+#include "bench_common.h"
+
+namespace {
+constexpr int BOX_WIDTH = 400;
+constexpr int BOX_HEIGHT = 60;
+constexpr int BOX_RADIUS = 8;
+constexpr int REPEATS = 1000;
+constexpr int CHECKS = 2000;
+constexpr int RUNS = 5;
+
+EInkDisplay display;
+GfxRenderer renderer(display);
+
+const char* const ORIENTATION_NAMES[] = {"portrait", "landscape cw", "portrait inverted", "landscape ccw"};
+
+void fillPixels(const int x, const int y, const int width, const int height, const bool state) {
+  for (int row = y; row < y + height; row++) {
+    for (int column = x; column < x + width; column++) {
+      if (column >= 0 && row >= 0 && column < renderer.getScreenWidth() && row < renderer.getScreenHeight()) {
+        renderer.drawPixel(column, row, state);
+      }
+    }
+  }
+}
+
+void outlinePixels(const int x, const int y, const int width, const int height) {
+  fillPixels(x, y, width, 1, true);
+  fillPixels(x, y + height - 1, width, 1, true);
+  fillPixels(x, y, 1, height, true);
+  fillPixels(x + width - 1, y, 1, height, true);
+}
+
+// Per pixel invert: the rectangle is drawn black on white to get its mask, which is then flipped in the saved frame
+void invertPixels(const int x, const int y, const int width, const int height, const std::vector<uint8_t>& before) {
+  renderer.clearScreen();
+  fillPixels(x, y, width, height, true);
+  for (uint32_t i = 0; i < EInkDisplay::BUFFER_SIZE; i++) {
+    display.frameBuffer[i] = before[i] ^ static_cast<uint8_t>(~display.frameBuffer[i]);
+  }
+}
+
+void fillNoise(bench::TextSource& noise) {
+  for (uint32_t i = 0; i < EInkDisplay::BUFFER_SIZE; i++) {
+    display.frameBuffer[i] = noise.next();
+  }
+}
+
+int checkOrientation(bench::TextSource& random) {
+  int mismatches = 0;
+  std::vector<uint8_t> before(EInkDisplay::BUFFER_SIZE);
+  std::vector<uint8_t> expected(EInkDisplay::BUFFER_SIZE);
+  for (int check = 0; check < CHECKS; check++) {
+    const int x = static_cast<int>(random.next() % (renderer.getScreenWidth() + 40)) - 20;
+    const int y = static_cast<int>(random.next() % (renderer.getScreenHeight() + 40)) - 20;
+    const int width = 1 + random.next() % 120;
+    const int height = 1 + random.next() % 120;
+    const int op = check % 5;
+
+    fillNoise(random);
+    before.assign(display.frameBuffer, display.frameBuffer + EInkDisplay::BUFFER_SIZE);
+    switch (op) {
+      case 0:
+        fillPixels(x, y, width, height, true);
+        break;
+      case 1:
+        fillPixels(x, y, width, height, false);
+        break;
+      case 2:
+        outlinePixels(x, y, width, height);
+        break;
+      case 3:
+        fillPixels(x, y, width, height, false);
+        break;
+      case 4:
+        invertPixels(x, y, width, height, before);
+        break;
+    }
+    expected.assign(display.frameBuffer, display.frameBuffer + EInkDisplay::BUFFER_SIZE);
+
+    memcpy(display.frameBuffer, before.data(), EInkDisplay::BUFFER_SIZE);
+    switch (op) {
+      case 0:
+        renderer.fillRect(x, y, width, height, true);
+        break;
+      case 1:
+        renderer.fillRect(x, y, width, height, false);
+        break;
+      case 2:
+        renderer.drawRect(x, y, width, height);
+        break;
+      case 3:
+        renderer.clearRect(x, y, width, height);
+        break;
+      case 4:
+        renderer.invertRect(x, y, width, height);
+        break;
+    }
+    mismatches += memcmp(display.frameBuffer, expected.data(), EInkDisplay::BUFFER_SIZE) != 0;
+  }
+  return mismatches;
+}
+
+template <typename Draw>
+double boxMs(Draw&& draw) {
+  return bench::bestOfMs(RUNS, [&] {
+    for (int i = 0; i < REPEATS; i++) {
+      draw(20 + i % 16, 30 + i % 64);
+    }
+  });
+}
+}  // namespace
+
+int main() {
+  bench::TextSource random(1234);
+  uint64_t totalHash = bench::hash(nullptr, 0);
+  int totalMismatches = 0;
+  printf("%d %dx%d boxes per timing, microseconds per box\n", REPEATS, BOX_WIDTH, BOX_HEIGHT);
+  for (int orientation = 0; orientation < 4; orientation++) {
+    renderer.setOrientation(static_cast<GfxRenderer::Orientation>(orientation));
+    const int mismatches = checkOrientation(random);
+    totalMismatches += mismatches;
+
+    renderer.clearScreen();
+    const double pixelsMs = boxMs([](const int x, const int y) { fillPixels(x, y, BOX_WIDTH, BOX_HEIGHT, true); });
+    const double fillMs = boxMs([](const int x, const int y) { renderer.fillRect(x, y, BOX_WIDTH, BOX_HEIGHT); });
+    const double outlinePixelsMs = boxMs([](const int x, const int y) { outlinePixels(x, y, BOX_WIDTH, BOX_HEIGHT); });
+    const double outlineMs = boxMs([](const int x, const int y) { renderer.drawRect(x, y, BOX_WIDTH, BOX_HEIGHT); });
+    const double invertMs = boxMs([](const int x, const int y) { renderer.invertRect(x, y, BOX_WIDTH, BOX_HEIGHT); });
+    const double roundedMs = boxMs(
+        [](const int x, const int y) { renderer.fillRoundedRect(x, y, BOX_WIDTH, BOX_HEIGHT, BOX_RADIUS, false); });
+
+    // What the shapes look like, for comparing against another build
+    renderer.clearScreen();
+    renderer.fillRect(10, 10, 100, 50);
+    renderer.drawRect(120, 10, 100, 50);
+    renderer.fillRoundedRect(10, 70, 200, 60, BOX_RADIUS);
+    renderer.drawRoundedRect(10, 140, 200, 60, BOX_RADIUS);
+    renderer.invertRect(50, 20, 150, 150);
+    renderer.clearRect(60, 100, 20, 20);
+    const uint64_t hash = bench::hash(display.getFrameBuffer(), EInkDisplay::BUFFER_SIZE);
+    totalHash = bench::hash(reinterpret_cast<const uint8_t*>(&hash), sizeof(hash), totalHash);
+
+    const double usPerBox = 1000.0 / REPEATS;
+    printf("%-17s fill %6.2f (pixels %6.2f)  outline %5.2f (pixels %6.2f)  invert %5.2f  rounded %5.2f  "
+           "mismatches %d/%d  hash %016llx\n",
+           ORIENTATION_NAMES[orientation], fillMs * usPerBox, pixelsMs * usPerBox, outlineMs * usPerBox,
+           outlinePixelsMs * usPerBox, invertMs * usPerBox, roundedMs * usPerBox, mismatches, CHECKS,
+           static_cast<unsigned long long>(hash));
+  }
+  printf("mismatches %d, hash %016llx\n", totalMismatches, static_cast<unsigned long long>(totalHash));
+  return totalMismatches == 0 ? 0 : 1;
+}
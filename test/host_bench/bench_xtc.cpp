@@ -0,0 +1,172 @@
+// XTC page loads: 20 rendered text pages written out as XTC (1-bit) and XTCH (2-bit) books, then rewritten with
+// PackBits pages by scripts/xtc_compress.py. Reports SD bytes and milliseconds per loaded page for each book, and
+// checks that the compressed books decode to the same bitmaps. Needs python3 on the path
+#include <GfxRenderer.h>
+#include <SDCardManager.h>
+#include <Xtc.h>
+#include <builtinFonts/all.h>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+
+namespace {
+constexpr int BOOK_FONT_ID = 1;
+constexpr int PAGE_COUNT = 20;
+constexpr int RUNS = 5;
+constexpr int PAGE_WIDTH = xtc::DISPLAY_WIDTH;
+constexpr int PAGE_HEIGHT = xtc::DISPLAY_HEIGHT;
+constexpr size_t XTG_SIZE = PAGE_WIDTH / 8 * PAGE_HEIGHT;
+constexpr size_t XTH_SIZE = PAGE_WIDTH * PAGE_HEIGHT / 8 * 2;
+
+EInkDisplay display;
+GfxRenderer renderer(display);
+EpdFont bookRegular(&bookerly_14_regular);
+EpdFont bookBold(&bookerly_14_bold);
+EpdFont bookItalic(&bookerly_14_italic);
+EpdFont bookBoldItalic(&bookerly_14_bolditalic);
+EpdFontFamily bookFamily(&bookRegular, &bookBold, &bookItalic, &bookBoldItalic);
+
+// Portrait logical (x, y) sits at panel (y, 479 - x), which is also where XTH keeps it: columns from the right, eight
+// vertical pixels per byte
+size_t panelOffset(const int x, const int y) {
+  return static_cast<size_t>(PAGE_WIDTH - 1 - x) * EInkDisplay::DISPLAY_WIDTH_BYTES + y / 8;
+}
+bool panelBit(const uint8_t* buffer, const int x, const int y) { return buffer[panelOffset(x, y)] >> (7 - y % 8) & 1; }
+
+// Renders a page in BW and both gray planes and stores it the way an XTC converter would
+void renderPage(bench::TextSource& text, std::vector<uint8_t>* xtg, std::vector<uint8_t>* xth) {
+  bench::TextSource grayText = text;
+  renderer.clearScreen();
+  bench::drawTextPage(renderer, BOOK_FONT_ID, text, 10);
+  const std::vector<uint8_t> bw(display.frameBuffer, display.frameBuffer + EInkDisplay::BUFFER_SIZE);
+  renderer.beginGrayscale();
+  bench::drawTextPage(renderer, BOOK_FONT_ID, grayText, 10);
+  renderer.copyGrayscaleBuffers();
+
+  xtg->assign(XTG_SIZE, 0);
+  xth->assign(XTH_SIZE, 0);
+  for (int y = 0; y < PAGE_HEIGHT; y++) {
+    for (int x = 0; x < PAGE_WIDTH; x++) {
+      // Framebuffer bits are set for white, the gray passes set them for the pixels they cover
+      const bool white = panelBit(bw.data(), x, y);
+      if (white) {
+        (*xtg)[y * (PAGE_WIDTH / 8) + x / 8] |= 0x80 >> (x % 8);
+      }
+      // XTH values: 0 white, 1 dark gray, 2 light gray, 3 black
+      const int value = white ? 0 : !panelBit(display.grayMsb, x, y) ? 3 : panelBit(display.grayLsb, x, y) ? 1 : 2;
+      const size_t offset = panelOffset(x, y);
+      const uint8_t bit = 0x80 >> (y % 8);
+      if (value & 2) {
+        (*xth)[offset] |= bit;
+      }
+      if (value & 1) {
+        (*xth)[XTH_SIZE / 2 + offset] |= bit;
+      }
+    }
+  }
+}
+
+bool writeBook(const char* path, const bool twoBit, const std::vector<std::vector<uint8_t>>& pages) {
+  FsFile file;
+  if (!SdMan.openFileForWrite("BXT", path, file)) {
+    return false;
+  }
+  constexpr char title[64] = "Host bench";
+  xtc::XtcHeader header = {};
+  header.magic = twoBit ? xtc::XTCH_MAGIC : xtc::XTC_MAGIC;
+  header.versionMajor = 1;
+  header.pageCount = pages.size();
+  header.headerSize = sizeof(header);
+  header.titleOffset = sizeof(header);
+  header.pageTableOffset = sizeof(header) + sizeof(title);
+  header.dataOffset = header.pageTableOffset + pages.size() * sizeof(xtc::PageTableEntry);
+  file.write(&header, sizeof(header));
+  file.write(title, sizeof(title));
+
+  uint64_t offset = header.dataOffset;
+  for (const auto& page : pages) {
+    const uint32_t size = sizeof(xtc::XtgPageHeader) + page.size();
+    const xtc::PageTableEntry entry = {offset, size, PAGE_WIDTH, PAGE_HEIGHT};
+    file.write(&entry, sizeof(entry));
+    offset += size;
+  }
+  for (const auto& page : pages) {
+    xtc::XtgPageHeader pageHeader = {};
+    pageHeader.magic = twoBit ? xtc::XTH_MAGIC : xtc::XTG_MAGIC;
+    pageHeader.width = PAGE_WIDTH;
+    pageHeader.height = PAGE_HEIGHT;
+    pageHeader.compression = xtc::COMPRESSION_NONE;
+    pageHeader.dataSize = page.size();
+    file.write(&pageHeader, sizeof(pageHeader));
+    file.write(page.data(), page.size());
+  }
+  file.close();
+  return true;
+}
+
+// Loads every page of a book, returns false if it fails to open or a page fails to load
+bool loadBook(const char* path, const size_t pageSize, uint64_t* hash) {
+  Xtc book(path, "/.crosspoint");
+  if (!book.load()) {
+    printf("!! %s failed to load\n", path);
+    return false;
+  }
+  std::vector<uint8_t> buffer(pageSize);
+  bool ok = true;
+  FsFile::readBytes = 0;
+  const double ms = bench::bestOfMs(RUNS, [&] {
+    *hash = bench::hash(nullptr, 0);
+    for (uint32_t page = 0; page < book.getPageCount(); page++) {
+      if (book.loadPage(page, buffer.data(), buffer.size()) != pageSize) {
+        ok = false;
+      }
+      *hash = bench::hash(buffer.data(), buffer.size(), *hash);
+    }
+  });
+  const unsigned long pageLoads = static_cast<unsigned long>(book.getPageCount()) * RUNS;
+  printf("%-22s %6lu bytes/page  %6.3f ms/page  hash %016llx%s\n", path, FsFile::readBytes / pageLoads,
+         ms / book.getPageCount(), static_cast<unsigned long long>(*hash), ok ? "" : "  !! page load failed");
+  return ok;
+}
+}  // namespace
+
+int main() {
+  renderer.insertFont(BOOK_FONT_ID, bookFamily);
+
+  std::vector<std::vector<uint8_t>> xtgPages(PAGE_COUNT);
+  std::vector<std::vector<uint8_t>> xthPages(PAGE_COUNT);
+  bench::TextSource text(42);
+  for (int page = 0; page < PAGE_COUNT; page++) {
+    renderPage(text, &xtgPages[page], &xthPages[page]);
+  }
+  if (!writeBook("/bench.xtc", false, xtgPages) || !writeBook("/bench.xtch", true, xthPages)) {
+    printf("!! could not write the books\n");
+    return 1;
+  }
+
+  const char* sdRoot = getenv("HOST_BENCH_SD");
+  const std::string root = sdRoot ? sdRoot : ".";
+  for (const std::string extension : {".xtc", ".xtch"}) {
+    const std::string command = "python3 scripts/xtc_compress.py " + root + "/bench" + extension + " " + root +
+                                "/bench_packbits" + extension;
+    if (std::system(command.c_str()) != 0) {
+      printf("!! %s failed\n", command.c_str());
+      return 1;
+    }
+  }
+
+  bool ok = true;
+  uint64_t plainHash = 0;
+  uint64_t packedHash = 0;
+  ok &= loadBook("/bench.xtc", XTG_SIZE, &plainHash);
+  ok &= loadBook("/bench_packbits.xtc", XTG_SIZE, &packedHash);
+  ok &= plainHash == packedHash;
+  ok &= loadBook("/bench.xtch", XTH_SIZE, &plainHash);
+  ok &= loadBook("/bench_packbits.xtch", XTH_SIZE, &packedHash);
+  ok &= plainHash == packedHash;
+  printf("%s\n", ok ? "compressed pages match" : "!! compressed pages differ");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,41 @@
+#pragma once
+// Just enough of the Arduino core for the libraries under lib/ to build and run on a desktop
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+inline unsigned long millis() {
+  using namespace std::chrono;
+  static const auto start = steady_clock::now();
+  return duration_cast<milliseconds>(steady_clock::now() - start).count();
+}
+
+inline unsigned long micros() {
+  using namespace std::chrono;
+  static const auto start = steady_clock::now();
+  return duration_cast<microseconds>(steady_clock::now() - start).count();
+}
+
+inline void delay(const unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+inline void yield() {}
+
+// Library logging is dropped unless HOST_BENCH_LOG is set, it would otherwise dominate the timings
+struct HardwareSerial {
+  template <typename... Args>
+  int printf(const char* format, Args... args) {
+    return getenv("HOST_BENCH_LOG") ? ::printf(format, args...) : 0;
+  }
+};
+inline HardwareSerial Serial;
+
+struct EspClass {
+  uint32_t getFreeHeap() { return 0; }
+  uint32_t getMinFreeHeap() { return 0; }
+  uint32_t getMaxAllocHeap() { return 0; }
+};
+inline EspClass ESP;
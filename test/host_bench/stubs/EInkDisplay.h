@@ -0,0 +1,28 @@
+#pragma once
+// Frame buffer only, refreshes are counted instead of sent anywhere and the gray planes are kept for inspection
+#include <Arduino.h>
+
+class EInkDisplay {
+ public:
+  static constexpr uint16_t DISPLAY_WIDTH = 800;
+  static constexpr uint16_t DISPLAY_HEIGHT = 480;
+  static constexpr uint16_t DISPLAY_WIDTH_BYTES = DISPLAY_WIDTH / 8;
+  static constexpr uint32_t BUFFER_SIZE = DISPLAY_WIDTH_BYTES * DISPLAY_HEIGHT;
+  enum RefreshMode { FULL_REFRESH, HALF_REFRESH, FAST_REFRESH };
+
+  uint8_t frameBuffer[BUFFER_SIZE] = {};
+  uint8_t grayLsb[BUFFER_SIZE] = {};
+  uint8_t grayMsb[BUFFER_SIZE] = {};
+  unsigned long refreshes = 0;
+
+  uint8_t* getFrameBuffer() { return frameBuffer; }
+  void clearScreen(const uint8_t color = 0xFF) { memset(frameBuffer, color, BUFFER_SIZE); }
+  void displayBuffer(RefreshMode = FAST_REFRESH) { refreshes++; }
+  void displayWindow(int, int, int, int) { refreshes++; }
+  void drawImage(const uint8_t*, int, int, int, int, bool = false) {}
+  void grayscaleRevert() {}
+  void copyGrayscaleLsbBuffers(const uint8_t* buffer) { memcpy(grayLsb, buffer, BUFFER_SIZE); }
+  void copyGrayscaleMsbBuffers(const uint8_t* buffer) { memcpy(grayMsb, buffer, BUFFER_SIZE); }
+  void displayGrayBuffer() { refreshes++; }
+  void cleanupGrayscaleBuffers(const uint8_t*) {}
+};
@@ -0,0 +1,16 @@
+#pragma once
+#include <Arduino.h>
+
+class Print {
+ public:
+  virtual ~Print() = default;
+  virtual size_t write(uint8_t byte) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t written = 0;
+    while (written < size && write(buffer[written])) {
+      written++;
+    }
+    return written;
+  }
+  size_t write(const char* str) { return write(reinterpret_cast<const uint8_t*>(str), strlen(str)); }
+};
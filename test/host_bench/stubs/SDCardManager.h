@@ -0,0 +1,41 @@
+#pragma once
+// SD card paths map onto the directory named by HOST_BENCH_SD
+#include <SdFat.h>
+
+#include <string>
+
+class SDCardManager {
+  static std::string hostPath(const char* path) {
+    const char* root = getenv("HOST_BENCH_SD");
+    return std::string(root ? root : ".") + path;
+  }
+
+ public:
+  bool openFileForRead(const char*, const std::string& path, FsFile& file) {
+    return file.openPath(hostPath(path.c_str()).c_str(), "rb");
+  }
+  bool openFileForRead(const char* module, const char* path, FsFile& file) {
+    return openFileForRead(module, std::string(path), file);
+  }
+  bool openFileForWrite(const char*, const std::string& path, FsFile& file) {
+    return file.openPath(hostPath(path.c_str()).c_str(), "w+b");
+  }
+  bool openFileForWrite(const char* module, const char* path, FsFile& file) {
+    return openFileForWrite(module, std::string(path), file);
+  }
+  bool exists(const char* path) {
+    struct stat st;
+    return stat(hostPath(path).c_str(), &st) == 0;
+  }
+  bool remove(const char* path) { return ::remove(hostPath(path).c_str()) == 0; }
+  bool rename(const char* from, const char* to) { return ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0; }
+  bool mkdir(const char* path, bool = true) { return ::mkdir(hostPath(path).c_str(), 0777) == 0; }
+  bool removeDir(const char* path) { return system(("rm -rf '" + hostPath(path) + "'").c_str()) == 0; }
+  bool rmdir(const char* path) { return ::rmdir(hostPath(path).c_str()) == 0; }
+  FsFile open(const char* path, oflag_t = O_RDONLY) {
+    FsFile file;
+    file.openPath(hostPath(path).c_str(), "rb");
+    return file;
+  }
+};
+inline SDCardManager SdMan;
@@ -0,0 +1,88 @@
+#pragma once
+// FsFile on top of stdio. Read and write byte counts are kept so benchmarks can report SD traffic
+#include <Print.h>
+#include <sys/stat.h>
+
+#include <memory>
+
+typedef int oflag_t;
+#define O_RDONLY 0
+#define O_RDWR 2
+
+class FsFile : public Print {
+  std::shared_ptr<FILE> f;
+
+ public:
+  static inline unsigned long readBytes = 0;
+  static inline unsigned long writeBytes = 0;
+
+  bool openPath(const char* path, const char* mode) {
+    FILE* file = fopen(path, mode);
+    if (!file) {
+      return false;
+    }
+    f.reset(file, fclose);
+    return true;
+  }
+  explicit operator bool() const { return static_cast<bool>(f); }
+  bool isOpen() const { return static_cast<bool>(f); }
+  void close() { f.reset(); }
+
+  int read() {
+    uint8_t byte;
+    return read(&byte, 1) == 1 ? byte : -1;
+  }
+  int read(void* buffer, const size_t size) {
+    if (!f) {
+      return -1;
+    }
+    const size_t count = fread(buffer, 1, size, f.get());
+    readBytes += count;
+    return static_cast<int>(count);
+  }
+  size_t write(const uint8_t byte) override { return write(&byte, 1); }
+  size_t write(const uint8_t* buffer, const size_t size) override {
+    if (!f) {
+      return 0;
+    }
+    writeBytes += size;
+    return fwrite(buffer, 1, size, f.get());
+  }
+  size_t write(const void* buffer, const size_t size) { return write(static_cast<const uint8_t*>(buffer), size); }
+
+  bool seek(const uint64_t position) { return f && fseek(f.get(), static_cast<long>(position), SEEK_SET) == 0; }
+  bool seekSet(const uint64_t position) { return seek(position); }
+  bool seekCur(const int64_t offset) { return f && fseek(f.get(), static_cast<long>(offset), SEEK_CUR) == 0; }
+  bool seekEnd(const int64_t offset = 0) { return f && fseek(f.get(), static_cast<long>(offset), SEEK_END) == 0; }
+  uint64_t position() { return f ? ftell(f.get()) : 0; }
+  uint64_t curPosition() { return position(); }
+  uint64_t size() {
+    if (!f) {
+      return 0;
+    }
+    const long current = ftell(f.get());
+    fseek(f.get(), 0, SEEK_END);
+    const long end = ftell(f.get());
+    fseek(f.get(), current, SEEK_SET);
+    return end;
+  }
+  uint64_t fileSize() { return size(); }
+  int available() {
+    const uint64_t end = size();
+    const uint64_t current = position();
+    return current < end ? static_cast<int>(std::min<uint64_t>(end - current, INT32_MAX)) : 0;
+  }
+  bool truncate(uint64_t) { return true; }
+  void flush() {
+    if (f) {
+      fflush(f.get());
+    }
+  }
+  bool sync() {
+    flush();
+    return true;
+  }
+  bool isDirectory() { return false; }
+  FsFile openNextFile() { return {}; }
+  size_t getName(char*, size_t) { return 0; }
+};